@@ -0,0 +1,240 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Replays the allocation patterns of reducers and WorkStorage against
+// basic_mempool::MemPool, compared with std::malloc/std::free.
+//
+// Reducer trace: every kernel creates a number of reducers, each of which
+// takes a tally, a per block partial array, and a result slot from the pools
+// and gives them back in reverse order when the kernel is done.
+//
+// WorkStorage trace: a WorkGroup is filled with loops, either allocating each
+// loop object separately (ArrayOfPointers) or growing one array by doubling
+// (RandomAccess), then all storage is released.
+//
+// Both traces run with a set of long lived allocations with holes between
+// them in the pool, as a pool shared by the rest of an application has.
+//
+// With OpenMP, every thread of a parallel region also takes and releases
+// scratch memory from one pool, with and without thread caching.
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+using pool_type = RAJA::basic_mempool::MemPool<
+    RAJA::basic_mempool::generic_allocator>;
+
+struct PoolAlloc {
+  void* malloc(size_t nbytes)
+  {
+    return pool_type::getInstance().malloc<char>(nbytes, RAJA::DATA_ALIGN);
+  }
+  void free(void* ptr) { pool_type::getInstance().free(ptr); }
+};
+
+struct StdAlloc {
+  void* malloc(size_t nbytes) { return std::malloc(nbytes); }
+  void free(void* ptr) { std::free(ptr); }
+};
+
+//! keep every other allocation of a random sequence alive
+template <typename Alloc>
+static std::vector<void*> fragment(Alloc& alloc, int num_live)
+{
+  std::mt19937 rng(12345);
+  std::vector<void*> all;
+  for (int i = 0; i < 2 * num_live; ++i) {
+    all.push_back(alloc.malloc(64 + rng() % 8192));
+  }
+  std::vector<void*> live;
+  for (int i = 0; i < 2 * num_live; ++i) {
+    if (i % 2 == 0) {
+      live.push_back(all[i]);
+    } else {
+      alloc.free(all[i]);
+    }
+  }
+  return live;
+}
+
+template <typename Alloc>
+static void benchmark_reducer_trace(benchmark::State& state)
+{
+  const int num_reducers = state.range(0);
+  const size_t num_blocks = 1024;
+
+  Alloc alloc;
+  std::vector<void*> live = fragment(alloc, 1000);
+  std::vector<void*> reducer_mem(3 * num_reducers);
+
+  while (state.KeepRunning()) {
+    for (int r = 0; r < num_reducers; ++r) {
+      reducer_mem[3 * r + 0] = alloc.malloc(sizeof(unsigned));
+      reducer_mem[3 * r + 1] = alloc.malloc(num_blocks * sizeof(double));
+      reducer_mem[3 * r + 2] = alloc.malloc(sizeof(double));
+    }
+    benchmark::DoNotOptimize(reducer_mem.data());
+    for (int i = 3 * num_reducers - 1; i >= 0; --i) {
+      alloc.free(reducer_mem[i]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * num_reducers);
+
+  for (void* ptr : live) {
+    alloc.free(ptr);
+  }
+}
+
+template <typename Alloc>
+static void benchmark_workstorage_pointers_trace(benchmark::State& state)
+{
+  const int num_loops = state.range(0);
+
+  Alloc alloc;
+  std::vector<void*> live = fragment(alloc, 1000);
+  std::vector<void*> loops(num_loops);
+
+  while (state.KeepRunning()) {
+    for (int l = 0; l < num_loops; ++l) {
+      loops[l] = alloc.malloc(64 + 32 * (l % 8));
+    }
+    benchmark::DoNotOptimize(loops.data());
+    for (int l = 0; l < num_loops; ++l) {
+      alloc.free(loops[l]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops);
+
+  for (void* ptr : live) {
+    alloc.free(ptr);
+  }
+}
+
+template <typename Alloc>
+static void benchmark_workstorage_array_trace(benchmark::State& state)
+{
+  const int num_loops = state.range(0);
+
+  Alloc alloc;
+  std::vector<void*> live = fragment(alloc, 1000);
+
+  while (state.KeepRunning()) {
+    size_t size = 0;
+    size_t capacity = 0;
+    void* array = nullptr;
+    for (int l = 0; l < num_loops; ++l) {
+      const size_t value_size = 64 + 32 * (l % 8);
+      if (size + value_size > capacity) {
+        capacity = std::max(size + value_size, 2 * capacity);
+        void* new_array = alloc.malloc(capacity);
+        if (array != nullptr) {
+          alloc.free(array);
+        }
+        array = new_array;
+      }
+      size += value_size;
+    }
+    benchmark::DoNotOptimize(array);
+    alloc.free(array);
+  }
+  state.SetItemsProcessed(state.iterations() * num_loops);
+
+  for (void* ptr : live) {
+    alloc.free(ptr);
+  }
+}
+
+static void benchmark_reducer_mempool(benchmark::State& state)
+{
+  benchmark_reducer_trace<PoolAlloc>(state);
+}
+static void benchmark_reducer_malloc(benchmark::State& state)
+{
+  benchmark_reducer_trace<StdAlloc>(state);
+}
+
+static void benchmark_workstorage_pointers_mempool(benchmark::State& state)
+{
+  benchmark_workstorage_pointers_trace<PoolAlloc>(state);
+}
+static void benchmark_workstorage_pointers_malloc(benchmark::State& state)
+{
+  benchmark_workstorage_pointers_trace<StdAlloc>(state);
+}
+
+static void benchmark_workstorage_array_mempool(benchmark::State& state)
+{
+  benchmark_workstorage_array_trace<PoolAlloc>(state);
+}
+static void benchmark_workstorage_array_malloc(benchmark::State& state)
+{
+  benchmark_workstorage_array_trace<StdAlloc>(state);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_omp_scratch(benchmark::State& state, size_t cache_size)
+{
+  const int num_allocs = state.range(0);
+
+  pool_type& pool = pool_type::getInstance();
+  const size_t prev_cache_size = pool.thread_cache_size(cache_size);
+
+  while (state.KeepRunning()) {
+    RAJA::region<RAJA::omp_parallel_region>([=]() {
+      pool_type& tpool = pool_type::getInstance();
+      for (int i = 0; i < num_allocs; ++i) {
+        double* scratch = tpool.malloc<double>(16 + 16 * (i % 4));
+        benchmark::DoNotOptimize(scratch);
+        tpool.free(scratch);
+      }
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * num_allocs *
+                          omp_get_max_threads());
+
+  pool.thread_cache_size(prev_cache_size);
+}
+
+static void benchmark_omp_scratch_mempool(benchmark::State& state)
+{
+  benchmark_omp_scratch(state, 0);
+}
+static void benchmark_omp_scratch_thread_cache(benchmark::State& state)
+{
+  benchmark_omp_scratch(state, 64 * 1024);
+}
+
+BENCHMARK(benchmark_omp_scratch_mempool)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(benchmark_omp_scratch_thread_cache)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+#endif
+
+BENCHMARK(benchmark_reducer_mempool)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(benchmark_reducer_malloc)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(benchmark_workstorage_pointers_mempool)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(benchmark_workstorage_pointers_malloc)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(benchmark_workstorage_array_mempool)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK(benchmark_workstorage_array_malloc)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+
+BENCHMARK_MAIN();
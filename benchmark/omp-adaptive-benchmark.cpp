@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares omp_adaptive_exec with a sequential loop and a full
+// omp_parallel_for_exec team on a daxpy whose length ranges from a few
+// hundred iterations, where opening a parallel region costs more than the
+// loop, to millions.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename ExecPol>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 2.0);
+  const double* px = x.data();
+  double* py = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, n),
+                          [=](RAJA::Index_type i) { py[i] += 0.5 * px[i]; });
+  }
+  benchmark::DoNotOptimize(y.data());
+}
+
+static void benchmark_seq(benchmark::State& state)
+{
+  benchmark_daxpy<RAJA::seq_exec>(state);
+}
+
+static void benchmark_parallel_for(benchmark::State& state)
+{
+  benchmark_daxpy<RAJA::omp_parallel_for_exec>(state);
+}
+
+static void benchmark_adaptive(benchmark::State& state)
+{
+  benchmark_daxpy<RAJA::omp_adaptive_exec<>>(state);
+}
+
+BENCHMARK(benchmark_seq)->RangeMultiplier(8)->Range(256, 1 << 21);
+BENCHMARK(benchmark_parallel_for)->RangeMultiplier(8)->Range(256, 1 << 21);
+BENCHMARK(benchmark_adaptive)->RangeMultiplier(8)->Range(256, 1 << 21);
+
+BENCHMARK_MAIN();
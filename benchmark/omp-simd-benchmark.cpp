@@ -0,0 +1,70 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the 'omp parallel for' policies with the 'omp parallel for simd'
+// policies on a triad through pointers the compiler can not prove do not
+// alias, with data that fits in cache and data that does not.
+//
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename ExecPol>
+static void benchmark_triad(benchmark::State& state)
+{
+  const RAJA::Index_type n = state.range(0);
+  auto& pool = RAJA::basic_mempool::MemPool<
+      RAJA::basic_mempool::generic_allocator>::getInstance();
+  double* a = pool.malloc<double>(n, RAJA::DATA_ALIGN);
+  double* b = pool.malloc<double>(n, RAJA::DATA_ALIGN);
+  double* c = pool.malloc<double>(n, RAJA::DATA_ALIGN);
+  for (RAJA::Index_type i = 0; i < n; ++i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, n),
+                          [=](RAJA::Index_type i) { a[i] = b[i] + 0.5 * c[i]; });
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(double));
+
+  pool.free(a);
+  pool.free(b);
+  pool.free(c);
+}
+
+static void benchmark_parallel_for(benchmark::State& state)
+{
+  benchmark_triad<RAJA::omp_parallel_for_exec>(state);
+}
+
+static void benchmark_parallel_for_static(benchmark::State& state)
+{
+  benchmark_triad<RAJA::omp_parallel_for_static_exec<>>(state);
+}
+
+static void benchmark_parallel_for_simd(benchmark::State& state)
+{
+  benchmark_triad<RAJA::omp_parallel_for_simd_exec>(state);
+}
+
+static void benchmark_parallel_for_simd_static(benchmark::State& state)
+{
+  benchmark_triad<RAJA::omp_parallel_for_simd_static_exec<>>(state);
+}
+
+BENCHMARK(benchmark_parallel_for)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(benchmark_parallel_for_static)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(benchmark_parallel_for_simd)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK(benchmark_parallel_for_simd_static)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the launch latency of short host loops: a plain loop, forall
+// with no active plugin, forall calling the hooks of a plugin that does
+// nothing, and forall timed by the bundled TimingPlugin. The first two should
+// be within noise of each other.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+// Registered but only active while a benchmark activates it.
+class EmptyPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  EmptyPlugin() : RAJA::util::PluginStrategy(forwarding_tag{}) { }
+
+  static void activate(bool on) { add_active_plugins(on ? 1 : -1); }
+};
+
+static RAJA::util::PluginRegistry::add<EmptyPlugin> P("empty-plugin",
+                                                      "Does nothing");
+
+static void benchmark_loop_raw(benchmark::State& state)
+{
+  const int len = state.range(0);
+  std::vector<double> x(len, 1.0);
+  std::vector<double> y(len, 2.0);
+  double* px = x.data();
+  double* py = y.data();
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < len; ++i) {
+      py[i] += 0.5 * px[i];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+enum struct Hooks { none, empty, timing };
+
+static void benchmark_forall(benchmark::State& state, Hooks hooks)
+{
+  const int len = state.range(0);
+  std::vector<double> x(len, 1.0);
+  std::vector<double> y(len, 2.0);
+  double* px = x.data();
+  double* py = y.data();
+
+  if (hooks == Hooks::empty) {
+    EmptyPlugin::activate(true);
+  } else if (hooks == Hooks::timing) {
+    RAJA::util::TimingPlugin::enable("benchmark-plugin-timing");
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, len),
+                                 [=](int i) { py[i] += 0.5 * px[i]; });
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+
+  if (hooks == Hooks::empty) {
+    EmptyPlugin::activate(false);
+  } else if (hooks == Hooks::timing) {
+    RAJA::util::TimingPlugin::disable();
+  }
+}
+
+static void benchmark_forall_no_plugin(benchmark::State& state)
+{
+  benchmark_forall(state, Hooks::none);
+}
+static void benchmark_forall_empty_plugin(benchmark::State& state)
+{
+  benchmark_forall(state, Hooks::empty);
+}
+static void benchmark_forall_timing_plugin(benchmark::State& state)
+{
+  benchmark_forall(state, Hooks::timing);
+}
+
+BENCHMARK(benchmark_loop_raw)->Arg(16)->Arg(1000)->Arg(10000);
+BENCHMARK(benchmark_forall_no_plugin)->Arg(16)->Arg(1000)->Arg(10000);
+BENCHMARK(benchmark_forall_empty_plugin)->Arg(16)->Arg(1000)->Arg(10000);
+BENCHMARK(benchmark_forall_timing_plugin)->Arg(16)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
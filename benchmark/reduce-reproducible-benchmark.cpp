@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the cost of omp_reduce_reproducible relative to omp_reduce for
+// a floating-point sum over state.range(0) values.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename ReducePol>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const int N = static_cast<int>(state.range(0));
+  std::vector<double> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = std::sin(1.7 * i) * std::pow(10.0, (i % 17) - 8);
+  }
+  const double* a = vals.data();
+
+  double result = 0.0;
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<ReducePol, double> sum(0.0);
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::TypedRangeSegment<int>(0, N),
+                                              [=](int i) { sum += a[i]; });
+    result = sum.get();
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+  state.SetBytesProcessed(state.iterations() * N * sizeof(double));
+}
+
+static void benchmark_omp_reduce(benchmark::State& state)
+{
+  benchmark_reduce_sum<RAJA::omp_reduce>(state);
+}
+
+static void benchmark_omp_reduce_reproducible(benchmark::State& state)
+{
+  benchmark_reduce_sum<RAJA::omp_reduce_reproducible>(state);
+}
+
+BENCHMARK(benchmark_omp_reduce)->Range(1 << 10, 1 << 24);
+BENCHMARK(benchmark_omp_reduce_reproducible)->Range(1 << 10, 1 << 24);
+
+BENCHMARK_MAIN();
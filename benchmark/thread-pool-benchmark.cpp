@@ -0,0 +1,51 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures fork/join overhead of thread_pool_exec on small daxpy loops,
+// compared with omp_parallel_for_exec when OpenMP is also enabled.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+template <typename ExecPol>
+static void benchmark_daxpy(benchmark::State& state)
+{
+  const RAJA::Index_type len = state.range(0);
+  std::vector<double> x(len, 1.0);
+  std::vector<double> y(len, 2.0);
+  const double* xp = x.data();
+  double* yp = y.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<RAJA::Index_type>(0, len),
+                          [=](RAJA::Index_type i) { yp[i] += 0.5 * xp[i]; });
+  }
+  benchmark::DoNotOptimize(y.data());
+}
+
+static void benchmark_thread_pool(benchmark::State& state)
+{
+  benchmark_daxpy<RAJA::thread_pool_exec>(state);
+}
+
+BENCHMARK(benchmark_thread_pool)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+#if defined(RAJA_ENABLE_OPENMP)
+static void benchmark_omp_parallel_for(benchmark::State& state)
+{
+  benchmark_daxpy<RAJA::omp_parallel_for_exec>(state);
+}
+
+BENCHMARK(benchmark_omp_parallel_for)->RangeMultiplier(8)->Range(64, 1 << 18);
+#endif
+
+BENCHMARK_MAIN();
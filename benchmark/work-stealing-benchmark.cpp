@@ -0,0 +1,102 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares omp_work_stealing_exec with static and dynamic OpenMP schedules
+// on a ListSegment loop whose per-index cost varies by two orders of
+// magnitude, as with material-dependent index lists.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 200000
+
+static std::vector<RAJA::Index_type> make_indices()
+{
+  std::vector<RAJA::Index_type> idx(N);
+  for (int i = 0; i < N; ++i) {
+    idx[i] = i;
+  }
+  std::shuffle(idx.begin(), idx.end(), std::mt19937(42));
+  return idx;
+}
+
+static std::vector<int> make_costs()
+{
+  // a few expensive clusters among mostly cheap indices
+  std::vector<int> cost(N, 1);
+  for (int i = 0; i < N; ++i) {
+    if ((i / 1000) % 16 == 0) {
+      cost[i] = 100;
+    }
+  }
+  return cost;
+}
+
+template <typename ExecPol>
+static void benchmark_irregular_list(benchmark::State& state)
+{
+  camp::resources::Resource res{camp::resources::Host()};
+  std::vector<RAJA::Index_type> idx = make_indices();
+  std::vector<int> cost = make_costs();
+  std::vector<double> out(N, 0.0);
+
+  RAJA::TypedListSegment<RAJA::Index_type> list(idx.data(), idx.size(), res);
+  const int* c = cost.data();
+  double* o = out.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<ExecPol>(list, [=](RAJA::Index_type i) {
+      double v = 0.0;
+      for (int k = 0; k < c[i]; ++k) {
+        v += std::sqrt(static_cast<double>(i + k));
+      }
+      o[i] = v;
+    });
+  }
+  benchmark::DoNotOptimize(out.data());
+}
+
+static void benchmark_static(benchmark::State& state)
+{
+  benchmark_irregular_list<RAJA::omp_parallel_for_static_exec<>>(state);
+}
+
+static void benchmark_dynamic_1(benchmark::State& state)
+{
+  benchmark_irregular_list<RAJA::omp_parallel_for_dynamic_exec<1>>(state);
+}
+
+static void benchmark_dynamic_64(benchmark::State& state)
+{
+  benchmark_irregular_list<RAJA::omp_parallel_for_dynamic_exec<64>>(state);
+}
+
+static void benchmark_work_stealing(benchmark::State& state)
+{
+  benchmark_irregular_list<RAJA::omp_work_stealing_exec<>>(state);
+}
+
+static void benchmark_work_stealing_64(benchmark::State& state)
+{
+  benchmark_irregular_list<RAJA::omp_work_stealing_exec<64>>(state);
+}
+
+BENCHMARK(benchmark_static);
+BENCHMARK(benchmark_dynamic_1);
+BENCHMARK(benchmark_dynamic_64);
+BENCHMARK(benchmark_work_stealing);
+BENCHMARK(benchmark_work_stealing_64);
+
+BENCHMARK_MAIN();
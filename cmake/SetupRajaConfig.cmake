@@ -53,6 +53,7 @@ include(CheckSymbolExists)
 check_symbol_exists(posix_memalign stdlib.h RAJA_HAVE_POSIX_MEMALIGN)
 check_symbol_exists(std::aligned_alloc stdlib.h RAJA_HAVE_ALIGNED_ALLOC)
 check_symbol_exists(_mm_malloc "" RAJA_HAVE_MM_MALLOC)
+check_symbol_exists(madvise sys/mman.h RAJA_HAVE_MADVISE)
 
 # Set up RAJA_ENABLE prefixed options
 set(RAJA_ENABLE_OPENMP ${ENABLE_OPENMP})
@@ -733,7 +733,7 @@ int main(int argc, char **argv)
 
     using workgroup_policy = RAJA::WorkGroupPolicy <
                                  RAJA::omp_work,
-                                 RAJA::ordered,
+                                 RAJA::unordered_omp_region_iter_balanced,
                                  RAJA::ragged_array_of_objects,
                                  RAJA::indirect_function_call_dispatch >;
 
@@ -92,6 +92,10 @@
 #endif
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+#include "RAJA/policy/thread_pool.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_DESUL_ATOMICS)
     #include "RAJA/policy/desul.hpp"
 #endif
@@ -190,9 +194,7 @@
 
 #include "RAJA/pattern/scan.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/PluginLinker.hpp"
-#endif
 
 #include "RAJA/pattern/sort.hpp"
 
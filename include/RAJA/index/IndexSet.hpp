@@ -23,6 +23,7 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -109,6 +110,8 @@ public:
     }
     // mark all as not owned by us
     owner.resize(num, 0);
+    m_seg_interval_begin = c.m_seg_interval_begin;
+    m_seg_interval_end = c.m_seg_interval_end;
   }
 
   //! Copy-assignment operator for index set
@@ -142,6 +145,8 @@ public:
     using std::swap;
     swap(data, other.data);
     swap(owner, other.owner);
+    swap(m_seg_interval_begin, other.m_seg_interval_begin);
+    swap(m_seg_interval_end, other.m_seg_interval_end);
   }
 
   ///
@@ -491,6 +496,10 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
@@ -507,6 +516,25 @@ public:
     return m_seg_interval_end[interval_id];
   }
 
+  //! get number of segment intervals that have been set
+  size_t getNumSegmentIntervals() const { return m_seg_interval_begin.size(); }
+
+  //!  @name Segment dependency graph methods
+  ///
+  /// A dependency graph holds one DepGraphNode per segment and is used by
+  /// the taskgraph segment iteration policies. Create it with
+  /// initDependencyGraph() after all segments have been added, fill in the
+  /// nodes returned by getDepGraphNode(), then call
+  /// finalizeDependencyGraph().
+  ///
+  /// A node's semaphore value is the number of its dependencies that must
+  /// complete before the segment may run in the next traversal. When the
+  /// segment starts the reload value is added to its semaphore, so
+  /// dependencies satisfied meanwhile count toward the next traversal, and
+  /// when it completes each dependent task is satisfied once.
+  ///
+  void initDependencyGraph() { this->resizeDependencyGraph(getNumSegments()); }
+
 protected:
   //! Returns the mapping of  segment_index -> segment_type
   RAJA_INLINE RAJA::RAJAVec<Index_type> &getSegmentTypes()
@@ -609,6 +637,8 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
+    m_dep_graph_set = c.m_dep_graph_set;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +649,8 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_dep_graph_set, other.m_dep_graph_set);
   }
 
 protected:
@@ -676,6 +708,14 @@ protected:
 
   RAJA_INLINE void increaseTotalLength(int n) { m_len += n; }
 
+  //! create a dependency graph with one default node per segment
+  void resizeDependencyGraph(size_t num_seg)
+  {
+    m_dep_graph.clear();
+    m_dep_graph.resize(num_seg);
+    m_dep_graph_set = false;
+  }
+
   template <typename P0, typename... PREST>
   RAJA_INLINE bool compareSegmentById(size_t,
                                       const TypedIndexSet<P0, PREST...> &) const
@@ -741,6 +781,22 @@ public:
   //! Return the number of elements in the range.
   Index_type size() const { return getNumSegments(); }
 
+  //! Mark the dependency graph as complete and ready for execution
+  void finalizeDependencyGraph() { m_dep_graph_set = true; }
+
+  //! Returns true if a dependency graph has been set up for the segments
+  bool dependencyGraphSet() const { return m_dep_graph_set; }
+
+  ///
+  /// Get the dependency graph node of the segment with given id. The node
+  /// may be modified through a const index set since its semaphore is
+  /// updated as the segments execute.
+  ///
+  DepGraphNode *getDepGraphNode(size_t segid) const
+  {
+    return &m_dep_graph[segid];
+  }
+
 private:
   //! Vector of segment types:    seg_index -> seg_type
   RAJA::RAJAVec<Index_type> segment_types;
@@ -754,6 +810,12 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Segment dependency graph:    seg_index -> dep_graph_node
+  mutable RAJA::RAJAVec<DepGraphNode> m_dep_graph;
+
+  //! true when m_dep_graph has been finalized
+  bool m_dep_graph_set = false;
 };
 
 
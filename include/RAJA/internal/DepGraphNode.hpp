@@ -60,6 +60,33 @@ public:
   {
   }
 
+  ///
+  /// Copy ctor copies the dependency data and current semaphore value.
+  ///
+  DepGraphNode(const DepGraphNode& other)
+      : m_num_dep_tasks(other.m_num_dep_tasks),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_semaphore_value(other.m_semaphore_value.load())
+  {
+    for (int tidx = 0; tidx < m_num_dep_tasks; ++tidx) {
+      m_dep_task[tidx] = other.m_dep_task[tidx];
+    }
+  }
+
+  ///
+  /// Copy-assignment copies the dependency data and current semaphore value.
+  ///
+  DepGraphNode& operator=(const DepGraphNode& other)
+  {
+    m_num_dep_tasks = other.m_num_dep_tasks;
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    for (int tidx = 0; tidx < m_num_dep_tasks; ++tidx) {
+      m_dep_task[tidx] = other.m_dep_task[tidx];
+    }
+    return *this;
+  }
+
   ///
   /// Get/set semaphore value; i.e., the current number of (unsatisfied)
   /// dependencies that must be satisfied before this task can execute.
@@ -78,14 +105,17 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Ready this task to be used again when it starts, keeping dependencies
+  /// of the next use that are satisfied while or before it runs
   ///
-  void satisfyOne()
-  {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
-    }
-  }
+  void reload() { m_semaphore_value.fetch_add(m_semaphore_reload_value); }
+
+  ///
+  /// Satisfy one incoming dependency and return the number of dependencies
+  /// still unsatisfied. Exactly one caller sees zero returned, so that
+  /// caller may launch this task.
+  ///
+  int satisfyOne() { return m_semaphore_value.fetch_sub(1) - 1; }
 
   ///
   /// Wait for all dependencies to be satisfied
@@ -24,7 +24,15 @@
 #include <cstddef>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
+#include <new>
 
+#if defined(RAJA_HAVE_MADVISE)
+#include <sys/mman.h>
+#endif
+
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
 #if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__) || \
@@ -121,6 +129,496 @@ struct FreeAlignedType : FreeAligned
   }
 };
 
+///
+/// Deleter function object that calls the destructor for the first size
+/// objects in the storage without releasing the storage.
+///
+template < typename T, typename index_type >
+struct DestroyType
+{
+  index_type size = 0;
+
+  void operator()(T* ptr)
+  {
+    for ( index_type i = size; i > 0; --i ) {
+      ptr[i-1].~T();
+    }
+  }
+};
+
+//! Allocator for aligned host memory for use in basic_mempool
+struct HostAllocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    return allocate_aligned(RAJA::DATA_ALIGN, nbytes);
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    free_aligned(ptr);
+    return true;
+  }
+};
+
+//! size of the transparent huge pages used by allocate_huge_pages
+constexpr size_t huge_page_size = 2ull * 1024ull * 1024ull;
+
+///
+/// Allocate size bytes, rounded up to a multiple of huge_page_size, aligned
+/// to huge_page_size and ask the OS to back them with transparent huge pages.
+/// The advice is a hint, the memory is usable whether it is taken or not.
+///
+inline void* allocate_huge_pages(size_t size)
+{
+  const size_t rounded =
+      (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+  void* ptr = allocate_aligned(huge_page_size, rounded);
+#if defined(RAJA_HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+  if (ptr != nullptr) {
+    madvise(ptr, rounded, MADV_HUGEPAGE);
+  }
+#endif
+  return ptr;
+}
+
+///
+/// Free memory allocated with allocate_huge_pages
+///
+inline void free_huge_pages(void* ptr) { free_aligned(ptr); }
+
+//! Allocator for huge page backed host memory for use in basic_mempool
+struct HugePageHostAllocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes) { return allocate_huge_pages(nbytes); }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    free_huge_pages(ptr);
+    return true;
+  }
+};
+
+///
+/// Standard library style allocator for huge page backed host memory, for
+/// example for WorkPool storage or containers of large arrays. Every
+/// allocation takes at least one huge page.
+///
+template <typename T>
+struct huge_page_allocator {
+  using value_type = T;
+
+  huge_page_allocator() = default;
+
+  template <typename U>
+  huge_page_allocator(huge_page_allocator<U> const&) noexcept
+  {
+  }
+
+  /*[[nodiscard]]*/
+  value_type* allocate(size_t num)
+  {
+    if (num > static_cast<size_t>(-1) / sizeof(value_type)) {
+      throw std::bad_alloc();
+    }
+    void* ptr = allocate_huge_pages(num * sizeof(value_type));
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<value_type*>(ptr);
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept { free_huge_pages(ptr); }
+
+  template <typename U>
+  friend inline bool operator==(huge_page_allocator const&,
+                                huge_page_allocator<U> const&)
+  {
+    return true;
+  }
+
+  template <typename U>
+  friend inline bool operator!=(huge_page_allocator const&,
+                                huge_page_allocator<U> const&)
+  {
+    return false;
+  }
+};
+
+//! Pool of host memory used for scratch space by host algorithms like sort
+using host_mempool_type = basic_mempool::MemPool<HostAllocator>;
+
+///
+/// Deleter function object for memory allocated from host_mempool_type
+///
+struct FreeHostMemPool
+{
+  void operator()(void* ptr)
+  {
+    host_mempool_type::getInstance().free(ptr);
+  }
+};
+
+///
+/// Largest scratch request host algorithms like sort take from
+/// host_mempool_type. Larger requests use the large scratch cache below, so
+/// one large sort does not leave the pool holding arenas of its size. It is
+/// half the default arena size so pooled requests fit in a default arena.
+///
+constexpr size_t host_scratch_pool_max_bytes =
+    host_mempool_type::default_default_arena_size / 2;
+
+namespace detail
+{
+
+///
+/// The few most recently freed scratch blocks larger than
+/// host_scratch_pool_max_bytes, kept so that large sorts repeated in a
+/// loop reuse their scratch space instead of allocating it each time.
+///
+struct HostScratchCache
+{
+  static constexpr int max_blocks = 4;
+  static constexpr size_t default_max_bytes = size_t(1) << 30;
+
+  std::mutex mutex;
+  void* ptrs[max_blocks] = {};
+  size_t sizes[max_blocks] = {};
+  size_t bytes = 0;
+  size_t max_bytes = default_max_bytes;
+
+  static HostScratchCache& get()
+  {
+    // never destroyed so scratch may be freed during static destruction
+    static HostScratchCache* cache = new HostScratchCache;
+    return *cache;
+  }
+
+  //! take the smallest cached block of at least nbytes, nullptr if none
+  void* take(size_t nbytes, size_t& size)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    int best = -1;
+    for (int i = 0; i < max_blocks; ++i) {
+      if (ptrs[i] != nullptr && sizes[i] >= nbytes &&
+          (best < 0 || sizes[i] < sizes[best])) {
+        best = i;
+      }
+    }
+    if (best < 0) {
+      return nullptr;
+    }
+    void* ptr = ptrs[best];
+    size = sizes[best];
+    bytes -= size;
+    ptrs[best] = nullptr;
+    sizes[best] = 0;
+    return ptr;
+  }
+
+  //! keep ptr of size bytes, dropping smaller cached blocks to make room,
+  //! or free it if it does not fit under max_bytes
+  void give(void* ptr, size_t size)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    void* dropped[max_blocks] = {};
+    int num_dropped = 0;
+    int slot = -1;
+    while (size <= max_bytes) {
+      int smallest = -1;
+      for (int i = 0; i < max_blocks; ++i) {
+        if (ptrs[i] == nullptr) {
+          slot = i;
+        } else if (smallest < 0 || sizes[i] < sizes[smallest]) {
+          smallest = i;
+        }
+      }
+      if (slot >= 0 && bytes + size <= max_bytes) {
+        break;
+      }
+      slot = -1;
+      if (smallest < 0 || sizes[smallest] >= size) {
+        break;
+      }
+      dropped[num_dropped++] = ptrs[smallest];
+      bytes -= sizes[smallest];
+      ptrs[smallest] = nullptr;
+      sizes[smallest] = 0;
+    }
+    if (slot >= 0) {
+      ptrs[slot] = ptr;
+      sizes[slot] = size;
+      bytes += size;
+      ptr = nullptr;
+    }
+    lock.unlock();
+    for (int i = 0; i < num_dropped; ++i) {
+      free_aligned(dropped[i]);
+    }
+    if (ptr != nullptr) {
+      free_aligned(ptr);
+    }
+  }
+
+  //! free every cached block
+  void trim()
+  {
+    void* dropped[max_blocks] = {};
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int i = 0; i < max_blocks; ++i) {
+        dropped[i] = ptrs[i];
+        ptrs[i] = nullptr;
+        sizes[i] = 0;
+      }
+      bytes = 0;
+    }
+    for (void* ptr : dropped) {
+      if (ptr != nullptr) {
+        free_aligned(ptr);
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+///
+/// Bytes of large scratch blocks kept for reuse between host algorithm
+/// calls.
+///
+inline size_t host_scratch_cached_bytes()
+{
+  detail::HostScratchCache& cache = detail::HostScratchCache::get();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  return cache.bytes;
+}
+
+///
+/// Most bytes of large scratch blocks kept for reuse, 1 GiB by default, 0
+/// disables keeping them. Returns the previous limit and frees the kept
+/// blocks.
+///
+inline size_t host_scratch_cache_max_bytes(size_t max_bytes)
+{
+  detail::HostScratchCache& cache = detail::HostScratchCache::get();
+  size_t prev_max_bytes;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    prev_max_bytes = cache.max_bytes;
+    cache.max_bytes = max_bytes;
+  }
+  cache.trim();
+  return prev_max_bytes;
+}
+
+///
+/// Free the large scratch blocks kept for reuse, for example after the
+/// last large sort of a run.
+///
+inline void trim_host_scratch() { detail::HostScratchCache::get().trim(); }
+
+///
+/// Deleter function object for memory allocated with allocate_host_scratch
+///
+struct FreeHostScratch
+{
+  //! bytes of a block from the large scratch cache, 0 if pooled
+  size_t size = 0;
+
+  void operator()(void* ptr)
+  {
+    if (size == 0) {
+      host_mempool_type::getInstance().free(ptr);
+    } else {
+      detail::HostScratchCache::get().give(ptr, size);
+    }
+  }
+};
+
+template <typename T>
+using host_scratch_ptr = std::unique_ptr<T, FreeHostScratch>;
+
+///
+/// Allocate uninitialized cache line aligned scratch space for n objects of
+/// type T, from host_mempool_type if it is at most
+/// host_scratch_pool_max_bytes. Larger requests reuse a block kept from an
+/// earlier request when one is large enough and are allocated otherwise.
+/// Holds nullptr if the memory could not be allocated.
+///
+template <typename T>
+host_scratch_ptr<T> allocate_host_scratch(size_t n)
+{
+  const size_t nbytes = n * sizeof(T);
+  if (nbytes <= host_scratch_pool_max_bytes) {
+    return host_scratch_ptr<T>(
+        host_mempool_type::getInstance().malloc<T>(n, RAJA::DATA_ALIGN),
+        FreeHostScratch{0});
+  }
+  size_t size = 0;
+  void* ptr = detail::HostScratchCache::get().take(nbytes, size);
+  if (ptr == nullptr) {
+    size = nbytes;
+    ptr = allocate_aligned(RAJA::DATA_ALIGN, nbytes);
+  }
+  return host_scratch_ptr<T>(static_cast<T*>(ptr), FreeHostScratch{size});
+}
+
+namespace detail
+{
+
+///
+/// Value aligned and padded to RAJA::DATA_ALIGN so neighboring threads
+/// never share a cache line.
+///
+template <typename T>
+struct alignas(RAJA::DATA_ALIGN) PaddedThreadSlot {
+  T value;
+};
+
+///
+/// One PaddedThreadSlot per thread, for example the thread-partial values
+/// of a reducer owned by the root copy. Threads are numbered by the
+/// back-end that uses the slots.
+///
+template <typename T>
+class PaddedThreadSlots
+{
+  using slot_type = PaddedThreadSlot<T>;
+  using slot_deleter = FreeAlignedType<slot_type, int>;
+
+  std::unique_ptr<slot_type[], slot_deleter> slots;
+
+public:
+  PaddedThreadSlots() = default;
+
+  PaddedThreadSlots(int num_slots, T const& init)
+  {
+    slot_type* ptr = allocate_aligned_type<slot_type>(
+        RAJA::DATA_ALIGN, num_slots * sizeof(slot_type));
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("PaddedThreadSlots failed to allocate thread slots");
+    }
+    slots = std::unique_ptr<slot_type[], slot_deleter>(ptr, slot_deleter{});
+    for (int i = 0; i < num_slots; ++i) {
+      new (&slots[i]) slot_type{init};
+      ++slots.get_deleter().size;
+    }
+  }
+
+  int size() const { return slots.get_deleter().size; }
+
+  T& operator[](int i) const { return slots[i].value; }
+
+  void fill(T const& val) const
+  {
+    for (int i = 0; i < size(); ++i) {
+      slots[i].value = val;
+    }
+  }
+
+  //! \return the slot of thread tid, or nullptr if tid has no slot
+  T* slot(int tid) const
+  {
+    return (tid >= 0 && tid < size()) ? &slots[tid].value : nullptr;
+  }
+};
+
+//! Block of aligned host memory kept by one thread for ThreadScratch
+struct ThreadScratchBlock
+{
+  void* ptr = nullptr;
+  size_t size = 0;
+  bool in_use = false;
+
+  ~ThreadScratchBlock()
+  {
+    if (ptr != nullptr) {
+      free_aligned(ptr);
+    }
+  }
+};
+
+inline ThreadScratchBlock& get_thread_scratch_block()
+{
+  static thread_local ThreadScratchBlock block;
+  return block;
+}
+
+}  // namespace detail
+
+///
+/// Scoped access to at least nbytes of cache line aligned host memory that
+/// belongs to the calling thread.
+///
+/// The memory is kept when the scope ends and reused by the next
+/// ThreadScratch on the same thread, growing when more is needed, so
+/// repeated requests do not allocate. A ThreadScratch created while another
+/// one is alive on the same thread gets memory of its own.
+///
+class ThreadScratch
+{
+public:
+  explicit ThreadScratch(size_t nbytes)
+  {
+    if (nbytes == 0) {
+      return;
+    }
+
+    detail::ThreadScratchBlock& block = detail::get_thread_scratch_block();
+    if (!block.in_use) {
+      if (block.size < nbytes) {
+        // grow geometrically so slowly increasing sizes rarely reallocate
+        size_t new_size = (nbytes > 2 * block.size) ? nbytes : 2 * block.size;
+        new_size = (new_size + RAJA::DATA_ALIGN - 1) / RAJA::DATA_ALIGN *
+                   RAJA::DATA_ALIGN;
+        if (block.ptr != nullptr) {
+          free_aligned(block.ptr);
+        }
+        block.ptr = allocate_aligned(RAJA::DATA_ALIGN, new_size);
+        block.size = (block.ptr != nullptr) ? new_size : 0;
+      }
+      if (block.ptr != nullptr) {
+        block.in_use = true;
+        m_block = &block;
+        m_ptr = block.ptr;
+      }
+    } else {
+      m_owned = allocate_aligned(RAJA::DATA_ALIGN, nbytes);
+      m_ptr = m_owned;
+    }
+
+    if (m_ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("ThreadScratch failed to allocate memory");
+    }
+  }
+
+  ThreadScratch(ThreadScratch const&) = delete;
+  ThreadScratch& operator=(ThreadScratch const&) = delete;
+
+  ~ThreadScratch()
+  {
+    if (m_block != nullptr) {
+      m_block->in_use = false;
+    }
+    if (m_owned != nullptr) {
+      free_aligned(m_owned);
+    }
+  }
+
+  //! get the memory, nullptr if zero bytes were requested
+  void* get() const { return m_ptr; }
+
+private:
+  detail::ThreadScratchBlock* m_block = nullptr;
+  void* m_owned = nullptr;
+  void* m_ptr = nullptr;
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -0,0 +1,137 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining the persistent thread pool used by the
+ *          thread_pool execution policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_ThreadPool_HPP
+#define RAJA_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace thread_pool
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Persistent pool of std::threads with a fork/join interface.
+ *
+ *         The pool is created on first use with RAJA_NUM_THREADS threads, or
+ *         std::thread::hardware_concurrency() threads when that environment
+ *         variable is not set. The thread calling run() takes part in the
+ *         work as thread 0, so the pool starts num_threads() - 1 workers.
+ *
+ *         Idle workers spin on a generation counter for a short time and
+ *         then park on a condition variable, so a fork costs one atomic
+ *         increment when the workers are hot and a notify when they are not.
+ *         The joining caller spins and parks the same way. Nobody spins when
+ *         the pool has more threads than the hardware has cores.
+ *
+ *         A call to run() made while the pool is busy, either from inside a
+ *         task or concurrently from another thread, executes the task on the
+ *         calling thread alone. Tasks must not throw.
+ *
+ ******************************************************************************
+ */
+class ThreadPool
+{
+public:
+  //! task signature, invoked once per thread with (data, thread id, threads)
+  using task_type = void (*)(void*, int, int);
+
+  //! get the process-wide pool, starting its workers on first use
+  static ThreadPool& get();
+
+  /*!
+   * \return the pool thread id of the calling thread: the worker index for
+   *         pool workers, 0 for the thread currently executing run(), and
+   *         -1 for any other thread.
+   */
+  static int thread_id();
+
+  //! number of threads that take part in run(), including the caller
+  int num_threads() const { return m_num_threads; }
+
+  //! run task on every pool thread and return when all have finished
+  void run(task_type task, void* data);
+
+  //! run func(thread_id, num_threads) on every pool thread
+  template <typename Func>
+  void run(Func& func)
+  {
+    run(&invoke<Func>, static_cast<void*>(&func));
+  }
+
+  ThreadPool(ThreadPool const&) = delete;
+  ThreadPool& operator=(ThreadPool const&) = delete;
+
+  ~ThreadPool();
+
+private:
+  explicit ThreadPool(int num_threads);
+
+  template <typename Func>
+  static void invoke(void* data, int tid, int nthreads)
+  {
+    (*static_cast<Func*>(data))(tid, nthreads);
+  }
+
+  void worker_loop(int tid);
+
+  unsigned wait_for_work(unsigned seen);
+
+  void wait_for_join();
+
+  const int m_num_threads;
+  const int m_spin_iterations;
+
+  std::vector<std::thread> m_workers;
+
+  //! held by the thread executing run()
+  std::mutex m_run_mutex;
+
+  task_type m_task = nullptr;
+  void* m_data = nullptr;
+
+  alignas(RAJA::DATA_ALIGN) std::atomic<unsigned> m_generation{0};
+  alignas(RAJA::DATA_ALIGN) std::atomic<int> m_remaining{0};
+  alignas(RAJA::DATA_ALIGN) std::atomic<int> m_num_parked{0};
+  std::atomic<bool> m_join_parked{false};
+  std::atomic<bool> m_stop{false};
+
+  std::mutex m_park_mutex;
+  std::condition_variable m_park_cv;
+  std::condition_variable m_join_cv;
+};
+
+}  // namespace thread_pool
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_THREAD_POOL
+
+#endif  // closing endif for header file include guard
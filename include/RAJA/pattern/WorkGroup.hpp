@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <iterator>
+
 #include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
@@ -257,10 +259,12 @@ public:
   template < typename segment_T, typename loop_T >
   inline void enqueue(segment_T&& seg, loop_T&& loop_body)
   {
+    long long num_iterations = 0;
     {
       // ignore zero length loops
-      using std::begin; using std::end;
+      using std::begin; using std::end; using std::distance;
       if (begin(seg) == end(seg)) return;
+      num_iterations = static_cast<long long>(distance(begin(seg), end(seg)));
     }
     if (m_storage.begin() == m_storage.end()) {
       // perform auto-reserve on reuse
@@ -268,6 +272,7 @@ public:
     }
 
     util::PluginContext context{util::make_context<exec_policy>()};
+    context.num_iterations = num_iterations;
     util::callPreCapturePlugins(context);
 
     using RAJA::util::trigger_updates_before;
@@ -275,6 +280,7 @@ public:
 
     m_runner.enqueue(
         m_storage, std::forward<segment_T>(seg), std::move(body));
+    m_num_iterations += num_iterations;
 
     util::callPostCapturePlugins(context);
   }
@@ -287,6 +293,7 @@ public:
     // but it was never used so no synchronization necessary
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkPool()
@@ -298,6 +305,7 @@ private:
   storage_type m_storage;
   size_t m_max_num_loops = 0;
   size_t m_max_storage_bytes = 0;
+  long long m_num_iterations = 0;
 
   workrunner_type m_runner;
 };
@@ -358,6 +366,7 @@ public:
     // TODO: synchronize
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkGroup()
@@ -368,10 +377,13 @@ public:
 private:
   storage_type m_storage;
   workrunner_type m_runner;
+  long long m_num_iterations;
 
-  WorkGroup(storage_type&& storage, workrunner_type&& runner)
+  WorkGroup(storage_type&& storage, workrunner_type&& runner,
+            long long num_iterations)
     : m_storage(std::move(storage))
     , m_runner(std::move(runner))
+    , m_num_iterations(num_iterations)
   { }
 };
 
@@ -469,7 +481,9 @@ WorkPool<
   m_max_storage_bytes = std::max(m_storage.storage_size(), m_max_storage_bytes);
 
   // move storage into workgroup
-  return workgroup_type{std::move(m_storage), std::move(m_runner)};
+  long long num_iterations = m_num_iterations;
+  m_num_iterations = 0;
+  return workgroup_type{std::move(m_storage), std::move(m_runner), num_iterations};
 }
 
 template <typename EXEC_POLICY_T,
@@ -497,6 +511,7 @@ WorkGroup<
                       Args... args)
 {
   util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
+  context.num_iterations = m_num_iterations;
   util::callPreLaunchPlugins(context);
 
   // move any per run storage into worksite
@@ -54,6 +54,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <type_traits>
@@ -69,6 +70,7 @@
 
 #include "RAJA/internal/fault_tolerance.hpp"
 
+#include "RAJA/util/AutoTuner.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Span.hpp"
 #include "RAJA/util/types.hpp"
@@ -309,6 +311,10 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
   //expt::check_forall_optional_args(loop_body, f_params);
 
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (context.hooks_active) {
+    context.num_iterations = static_cast<long long>(c.getLength());
+    expt::set_plugin_context(context, f_params);
+  }
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -364,6 +370,10 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
   expt::check_forall_optional_args(loop_body, f_params);
 
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (context.hooks_active) {
+    context.num_iterations = static_cast<long long>(c.getLength());
+    expt::set_plugin_context(context, f_params);
+  }
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -457,6 +467,11 @@ forall_Icount(ExecutionPolicy&& p,
   //expt::check_forall_optional_args(loop_body, f_params);
 
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (context.hooks_active) {
+    using std::begin; using std::end; using std::distance;
+    context.num_iterations = static_cast<long long>(distance(begin(c), end(c)));
+    expt::set_plugin_context(context, f_params);
+  }
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -525,6 +540,11 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, Params&&... params)
   expt::check_forall_optional_args(loop_body, f_params);
 
   util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  if (context.hooks_active) {
+    using std::begin; using std::end; using std::distance;
+    context.num_iterations = static_cast<long long>(distance(begin(c), end(c)));
+    expt::set_plugin_context(context, f_params);
+  }
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -744,6 +764,67 @@ namespace expt
     return dynamic_helper<N-1, POLICY_LIST>::invoke_forall(r, pol, seg, body);
   }
 
+  /*!
+   * Run the kernel with the policy of POLICY_LIST that was fastest for it.
+   *
+   * The first calls of each kernel name time each policy in turn, see
+   * AutoTuner::trials, then the policy with the shortest time is used for
+   * the rest of the run. Choices are kept per policy list and length class
+   * of the segment and may be saved to a file, see AutoTuner. Policies must
+   * finish the kernel before forall returns for the times to be meaningful.
+   *
+   * Each call site remembers its last kernel by the address of kernel_name,
+   * so kernel_name must not point to a buffer that is later overwritten with
+   * another name; string literals and strings that outlive the calls are
+   * fine.
+   */
+  template<typename POLICY_LIST, typename SEGMENT, typename BODY>
+  void tuned_forall(const char* kernel_name, SEGMENT const &seg, BODY const &body)
+  {
+    constexpr int N = camp::size<POLICY_LIST>::value;
+    static_assert(N > 0, "RAJA policy list must not be empty");
+
+    using std::begin; using std::end; using std::distance;
+    const int length_class = AutoTuner::length_class(
+        static_cast<long long>(distance(begin(seg), end(seg))));
+
+    AutoTuner& tuner = AutoTuner::getInstance();
+
+    // remember the last kernel of this call site to skip the lookup, the
+    // name is compared by address only
+    struct cached_kernel {
+      const char* name = nullptr;
+      int length_class = -1;
+      unsigned generation = 0;
+      TunedKernel* kernel = nullptr;
+    };
+    static thread_local cached_kernel cache;
+    const unsigned generation = tuner.generation();
+    if (cache.name != kernel_name || cache.length_class != length_class ||
+        cache.generation != generation) {
+      static const uint64_t list_id =
+          AutoTuner::list_id(RAJA::util::detail::type_name<POLICY_LIST>());
+      cache.kernel = &tuner.kernel(kernel_name, list_id, N, length_class);
+      cache.name = kernel_name;
+      cache.length_class = length_class;
+      cache.generation = generation;
+    }
+    TunedKernel& kernel = *cache.kernel;
+
+    int pol = kernel.choice.load(std::memory_order_acquire);
+    if (pol >= 0) {
+      dynamic_forall<POLICY_LIST>(pol, seg, body);
+      return;
+    }
+
+    pol = tuner.next_policy(kernel);
+    const auto start = std::chrono::steady_clock::now();
+    dynamic_forall<POLICY_LIST>(pol, seg, body);
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    tuner.record(kernel, pol, elapsed.count());
+  }
+
 }  // namespace expt
 
 
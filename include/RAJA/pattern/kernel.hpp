@@ -30,6 +30,8 @@
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/pattern/params/forall.hpp"
+
 #include "RAJA/pattern/kernel/internal.hpp"
 
 namespace RAJA
@@ -82,6 +84,22 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+//! number of iterations in the product of the segments
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE long long iteration_space_size(Tuple const &t, camp::idx_seq<I...>)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  long long size = 1;
+  long long lengths[] = {1, static_cast<long long>(distance(
+                                begin(camp::get<I>(t)), end(camp::get<I>(t))))...};
+  for (long long length : lengths) {
+    size *= length;
+  }
+  return size;
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -107,6 +125,12 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Bodies &&... bodies)
 {
   util::PluginContext context{util::make_context<PolicyType>()};
+  if (context.hooks_active) {
+    context.num_iterations = internal::iteration_space_size(
+        segments,
+        camp::make_idx_seq_t<camp::tuple_size<camp::decay<SegmentTuple>>::value>{});
+    expt::set_plugin_context(context, params);
+  }
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
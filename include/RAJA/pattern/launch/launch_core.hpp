@@ -170,11 +170,16 @@ public:
   {
   }
 
-  //TODO handle alignment
+  // shared_mem_offset counts bytes, and each returned pointer is aligned
+  // for T, so shared memory sizes must allow for padding between types
   template<typename T>
   RAJA_HOST_DEVICE T* getSharedMemory(size_t bytes)
   {
-    T * mem_ptr = &((T*) shared_mem_ptr)[shared_mem_offset];
+    constexpr size_t align = alignof(T);
+    shared_mem_offset = (shared_mem_offset + align - 1) / align * align;
+
+    T * mem_ptr = reinterpret_cast<T*>(
+        static_cast<char*>(shared_mem_ptr) + shared_mem_offset);
 
     shared_mem_offset += bytes*sizeof(T);
     return mem_ptr;
@@ -214,6 +219,36 @@ public:
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
+namespace detail
+{
+
+//! pass the name, dimensions and params of a launch on to plugins
+template <typename ReduceParams>
+RAJA_INLINE void set_launch_plugin_context(util::PluginContext &context,
+                                           LaunchParams const &launch_params,
+                                           const char *kernel_name,
+                                           ReduceParams const &reducers)
+{
+  if (!context.hooks_active) {
+    return;
+  }
+  expt::set_plugin_context(context, reducers);
+  if (kernel_name != nullptr) {
+    context.kernel_name = kernel_name;
+  }
+  // count each thread of each team as an iteration
+  long long num_iterations = 1;
+  for (int d = 0; d < 3; ++d) {
+    context.teams[d] = launch_params.teams.value[d];
+    context.threads[d] = launch_params.threads.value[d];
+    num_iterations *= static_cast<long long>(launch_params.teams.value[d]) *
+                      launch_params.threads.value[d];
+  }
+  context.num_iterations = num_iterations;
+}
+
+}  // namespace detail
+
 //Policy based launch with support to new reducers...
 template <typename LAUNCH_POLICY, typename ... ReduceParams>
 void launch(LaunchParams const &launch_params, const char *kernel_name, ReduceParams&&... rest_of_launch_args)
@@ -227,6 +262,7 @@ void launch(LaunchParams const &launch_params, const char *kernel_name, ReducePa
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
   util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>()};
+  detail::set_launch_plugin_context(context, launch_params, kernel_name, reducers);
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -261,6 +297,7 @@ void launch(LaunchParams const &launch_params, ReduceParams&&... rest_of_launch_
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
   util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>()};
+  detail::set_launch_plugin_context(context, launch_params, kernel_name, reducers);
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -418,6 +455,7 @@ launch(RAJA::resources::Resource res, LaunchParams const &launch_params,
   util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
 #endif
 
+  detail::set_launch_plugin_context(context, launch_params, kernel_name, reducers);
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -486,6 +524,7 @@ launch(RAJA::resources::Resource res, LaunchParams const &launch_params,
   util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
 #endif
 
+  detail::set_launch_plugin_context(context, launch_params, kernel_name, reducers);
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -4,12 +4,17 @@
 #include "RAJA/policy/sequential/params/reduce.hpp"
 #include "RAJA/policy/openmp/params/reduce.hpp"
 #include "RAJA/policy/openmp_target/params/reduce.hpp"
+#include "RAJA/policy/thread_pool/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/reduce.hpp"
 #include "RAJA/policy/cuda/params/kernel_name.hpp"
 #include "RAJA/policy/hip/params/reduce.hpp"
 #include "RAJA/policy/sycl/params/reduce.hpp"
 
+#include "RAJA/pattern/params/kernel_name.hpp"
+#include "RAJA/pattern/params/kernel_cost.hpp"
+
 #include "RAJA/util/CombiningAdapter.hpp"
+#include "RAJA/util/PluginContext.hpp"
 
 namespace RAJA
 {
@@ -173,6 +178,75 @@ namespace expt
 
 
 
+  //===========================================================================
+  //
+  //
+  // Pass the params meant for plugins on to the PluginContext.
+  //
+  //
+  namespace detail {
+    template<typename T>
+    RAJA_INLINE void set_plugin_context(util::PluginContext&, const T&) {}
+
+    RAJA_INLINE void set_plugin_context(util::PluginContext& context, const KernelName& kn) {
+      context.kernel_name = kn.name;
+    }
+
+    RAJA_INLINE void set_plugin_context(util::PluginContext& context, const KernelCost& kc) {
+      context.bytes_per_iteration = kc.bytes_per_iteration;
+      context.flops_per_iteration = kc.flops_per_iteration;
+    }
+
+    template<camp::idx_t... Seq, typename TupleType>
+    RAJA_INLINE void set_plugin_context_from_tuple(util::PluginContext& context, const TupleType& tuple, camp::idx_seq<Seq...>) {
+      CAMP_EXPAND(set_plugin_context(context, camp::get<Seq>(tuple)));
+    }
+  } // namespace detail
+
+  template<typename... Params>
+  RAJA_INLINE void set_plugin_context(util::PluginContext& context, const ForallParamPack<Params...>& f_params) {
+    detail::set_plugin_context_from_tuple(context, f_params.param_tup, typename ForallParamPack<Params...>::params_seq());
+  }
+
+  // Used with the parameter tuple of kernel.
+  template<typename... Ts>
+  RAJA_INLINE void set_plugin_context(util::PluginContext& context, const camp::tuple<Ts...>& params) {
+    detail::set_plugin_context_from_tuple(context, params, camp::make_idx_seq_t<sizeof...(Ts)>());
+  }
+  //===========================================================================
+
+
+
+  //===========================================================================
+  //
+  //
+  // The KernelCost of a param pack, zero costs without one.
+  //
+  //
+  namespace detail {
+    template<typename T>
+    RAJA_INLINE void set_kernel_cost(KernelCost&, const T&) {}
+
+    RAJA_INLINE void set_kernel_cost(KernelCost& cost, const KernelCost& kc) {
+      cost = kc;
+    }
+
+    template<camp::idx_t... Seq, typename TupleType>
+    RAJA_INLINE void set_kernel_cost_from_tuple(KernelCost& cost, const TupleType& tuple, camp::idx_seq<Seq...>) {
+      CAMP_EXPAND(set_kernel_cost(cost, camp::get<Seq>(tuple)));
+    }
+  } // namespace detail
+
+  template<typename... Params>
+  RAJA_INLINE detail::KernelCost get_kernel_cost(const ForallParamPack<Params...>& f_params) {
+    detail::KernelCost cost;
+    detail::set_kernel_cost_from_tuple(cost, f_params.param_tup, typename ForallParamPack<Params...>::params_seq());
+    return cost;
+  }
+  //===========================================================================
+
+
+
   //===========================================================================
   //
   //
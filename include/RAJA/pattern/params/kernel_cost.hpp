@@ -0,0 +1,50 @@
+#ifndef RAJA_KERNEL_COST_HPP
+#define RAJA_KERNEL_COST_HPP
+
+#include "RAJA/pattern/params/params_base.hpp"
+
+namespace RAJA
+{
+namespace expt
+{
+namespace detail
+{
+
+  struct KernelCost : public ForallParamBase {
+    RAJA_HOST_DEVICE KernelCost() {}
+    KernelCost(double bytes_in, double flops_in)
+      : bytes_per_iteration(bytes_in), flops_per_iteration(flops_in) {}
+    double bytes_per_iteration = 0.0;
+    double flops_per_iteration = 0.0;
+  };
+
+  // The cost is only passed on to plugins, no back-end uses it.
+
+  // Init
+  template<typename EXEC_POL, typename... Args>
+  void init(KernelCost&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Args>
+  RAJA_HOST_DEVICE
+  void combine(KernelCost&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Args>
+  void resolve(KernelCost&, Args&&...) {}
+
+} // namespace detail
+
+//! Declare the bytes moved and flops done by each iteration of a kernel
+inline auto KernelCost(double bytes_per_iteration, double flops_per_iteration = 0.0)
+{
+  return detail::KernelCost(bytes_per_iteration, flops_per_iteration);
+}
+} // namespace expt
+
+
+} //  namespace RAJA
+
+
+
+#endif // KERNEL_COST_HPP
@@ -1,6 +1,7 @@
 #ifndef RAJA_KERNEL_NAME_HPP
 #define RAJA_KERNEL_NAME_HPP
 
+#include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/pattern/params/params_base.hpp"
 
 namespace RAJA
@@ -16,6 +17,24 @@ namespace detail
     const char* name;
   };
 
+  // Back-ends other than CUDA only pass the name on to plugins.
+
+  // Init
+  template<typename EXEC_POL, typename... Args>
+  camp::concepts::enable_if< camp::concepts::negate<RAJA::type_traits::is_cuda_policy<EXEC_POL>> >
+  init(KernelName&, Args&&...) {}
+
+  // Combine
+  template<typename EXEC_POL, typename... Args>
+  RAJA_HOST_DEVICE
+  camp::concepts::enable_if< camp::concepts::negate<RAJA::type_traits::is_cuda_policy<EXEC_POL>> >
+  combine(KernelName&, Args&&...) {}
+
+  // Resolve
+  template<typename EXEC_POL, typename... Args>
+  camp::concepts::enable_if< camp::concepts::negate<RAJA::type_traits::is_cuda_policy<EXEC_POL>> >
+  resolve(KernelName&, Args&&...) {}
+
 } // namespace detail
 
 inline auto KernelName(const char * n)
@@ -94,7 +94,7 @@ namespace expt
       multiply_accumulate(left_type const &A, right_type const &B, result_type &C)
       {
 #if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-        RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
+        RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_matrix_mm_multacc_row_row);
 #endif
 
         constexpr camp::idx_t num_bc_reg_per_row = s_C_minor_dim_registers;
@@ -238,7 +238,7 @@ namespace expt
         {
 
   #if defined(RAJA_ENABLE_VECTOR_STATS) && !defined(__CUDA_ARCH__)
-          RAJA::tensor_stats::num_matrix_mm_multacc_row_row ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_matrix_mm_multacc_row_row);
   #endif
 
 
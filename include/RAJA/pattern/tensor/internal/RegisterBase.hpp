@@ -218,7 +218,7 @@ namespace expt
       RAJA_INLINE
       self_type &gather(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> offsets){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           getThis()->set(ptr[offsets.get(i)], i);
@@ -241,7 +241,7 @@ namespace expt
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
           for(camp::idx_t i = 0;i < N;++ i){
             getThis()->set(ptr[offsets.get(i)], i);
@@ -326,7 +326,7 @@ namespace expt
       RAJA_INLINE
       self_type const &scatter(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets) const {
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         for(camp::idx_t i = 0;i < self_type::s_num_elem;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
@@ -348,7 +348,7 @@ namespace expt
       RAJA_INLINE
       self_type const &scatter_n(element_type *ptr, RAJA::expt::Register<T2, REGISTER_POLICY> const &offsets, camp::idx_t N) const {
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[offsets.get(i)] = getThis()->get(i);
@@ -257,14 +257,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed);
               #endif
                 self.load_packed(ptr);
               }
               // partial
               else{
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed_n);
               #endif
                 self.load_packed_n(ptr, ref.m_tile.m_size[0]);
               }
@@ -276,14 +276,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided);
               #endif
                 self.load_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
               #endif
                 self.load_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
@@ -306,14 +306,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed);
     #endif
                 self.store_packed(ptr);
               }
               // partial
               else{
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed_n);
     #endif
                 self.store_packed_n(ptr, ref.m_tile.m_size[0]);
               }
@@ -325,14 +325,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided);
     #endif
                 self.store_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided_n);
     #endif
                 self.store_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
@@ -367,14 +367,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed);
               #endif
                 self.load_packed(ptr);
               }
               // partial
               else{
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_packed_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed_n);
               #endif
                 self.load_packed_n(ptr, ref.m_tile.m_size[0]);
               }
@@ -386,14 +386,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided);
               #endif
                 self.load_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
               #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_load_strided_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
               #endif
                 self.load_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
@@ -416,14 +416,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed);
     #endif
                 self.store_packed(ptr);
               }
               // partial
               else{
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_packed_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed_n);
     #endif
                 self.store_packed_n(ptr, ref.m_tile.m_size[0]);
               }
@@ -435,14 +435,14 @@ namespace expt
               // full vector?
               if(TENSOR_SIZE == RAJA::internal::expt::TENSOR_FULL){
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided);
     #endif
                 self.store_strided(ptr, ref.m_stride[0]);
               }
               // partial
               else{
     #ifdef RAJA_ENABLE_VECTOR_STATS
-              RAJA::tensor_stats::num_vector_store_strided_n ++;
+              RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided_n);
     #endif
                 self.store_strided_n(ptr, ref.m_stride[0], ref.m_tile.m_size[0]);
               }
@@ -16,8 +16,8 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
 
-// Place the following line before including RAJA to enable
-// statistics on the Vector abstractions
+// Configure RAJA with RAJA_ENABLE_VECTOR_STATS=On to enable statistics on
+// the Vector abstractions, which defines the following in RAJA/config.hpp
 // #define RAJA_ENABLE_VECTOR_STATS
 
 
@@ -25,58 +25,133 @@
 #define RAJA_pattern_simd_register_stats_HPP
 
 #include "RAJA/config.hpp"
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <string>
+
 #include "camp/camp.hpp"
 
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
 namespace expt
 {
+
+/*!
+ * Counters of the operations done by the tensor abstractions. Every thread
+ * counts into its own counters, and with attributeToKernels(true) into
+ * separate counters for each kernel name it runs, so counting needs no
+ * atomic read-modify-write and threads do not share cache lines. The
+ * counters are summed when they are read.
+ */
 struct tensor_stats
 {
     static int indent;
 
-  static camp::idx_t num_vector_copy;
-  static camp::idx_t num_vector_copy_ctor;
-  static camp::idx_t num_vector_broadcast_ctor;
-
-  static camp::idx_t num_vector_load_packed;
-  static camp::idx_t num_vector_load_packed_n;
-  static camp::idx_t num_vector_load_strided;
-  static camp::idx_t num_vector_load_strided_n;
+  enum stat : int {
+    num_vector_copy,
+    num_vector_copy_ctor,
+    num_vector_broadcast_ctor,
+
+    num_vector_load_packed,
+    num_vector_load_packed_n,
+    num_vector_load_strided,
+    num_vector_load_strided_n,
+
+    num_vector_store_packed,
+    num_vector_store_packed_n,
+    num_vector_store_strided,
+    num_vector_store_strided_n,
+
+    num_vector_broadcast,
+
+    num_vector_get,
+    num_vector_set,
+
+    num_vector_add,
+    num_vector_subtract,
+    num_vector_multiply,
+    num_vector_divide,
+
+    num_vector_fma,
+    num_vector_fms,
+
+    num_vector_sum,
+    num_vector_max,
+    num_vector_min,
+    num_vector_vmax,
+    num_vector_vmin,
+    num_vector_dot,
+
+
+    num_matrix_mm_mult_row_row,
+    num_matrix_mm_multacc_row_row,
+    num_matrix_mm_mult_col_col,
+    num_matrix_mm_multacc_col_col,
+
+    num_stats
+  };
+
+  using counts = std::array<camp::idx_t, num_stats>;
+
+  //! counters of one thread for one kernel name, padded so they do not
+  //! share cache lines with other memory
+  struct counter_block {
+    char front_padding[64];
+    std::atomic<camp::idx_t> values[num_stats];
+    char back_padding[64];
+  };
+
+  //! Count one operation s on the calling thread.
+  RAJA_HOST_DEVICE
+  static RAJA_INLINE void count(stat s)
+  {
+#if !defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE)
+    counter_block* block = current_block;
+    if (block == nullptr) {
+      block = registerThread();
+    }
+    // only this thread writes the counter, readers only need a whole value
+    block->values[s].store(
+        block->values[s].load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+#else
+    RAJA_UNUSED_VAR(s);
+#endif
+  }
 
-  static camp::idx_t num_vector_store_packed;
-  static camp::idx_t num_vector_store_packed_n;
-  static camp::idx_t num_vector_store_strided;
-  static camp::idx_t num_vector_store_strided_n;
+  //! name of counter s, for example "num_vector_load_strided"
+  static RAJASHAREDDLL_API const char* name(stat s);
 
-  static camp::idx_t num_vector_broadcast;
+  //! sum of counter s over all threads and kernels
+  static RAJASHAREDDLL_API camp::idx_t total(stat s);
 
-  static camp::idx_t num_vector_get;
-  static camp::idx_t num_vector_set;
+  //! all counters summed over all threads and kernels
+  static RAJASHAREDDLL_API counts totals();
 
-  static camp::idx_t num_vector_add;
-  static camp::idx_t num_vector_subtract;
-  static camp::idx_t num_vector_multiply;
-  static camp::idx_t num_vector_divide;
+  //! all counters summed over all threads for each kernel name, operations
+  //! outside of kernels or not attributed to kernels are under ""
+  static RAJASHAREDDLL_API std::map<std::string, counts> kernelTotals();
 
-  static camp::idx_t num_vector_fma;
-  static camp::idx_t num_vector_fms;
+  //! Count operations separately for each kernel name, see
+  //! PluginContext::name, while on. Off by default.
+  static RAJASHAREDDLL_API void attributeToKernels(bool on);
 
-  static camp::idx_t num_vector_sum;
-  static camp::idx_t num_vector_max;
-  static camp::idx_t num_vector_min;
-  static camp::idx_t num_vector_vmax;
-  static camp::idx_t num_vector_vmin;
-  static camp::idx_t num_vector_dot;
+  static RAJASHAREDDLL_API void resetVectorStats();
+  static RAJASHAREDDLL_API void printVectorStats();
 
+  //! Write the totals and the counters of each kernel name as JSON to
+  //! filename, returns false if the file could not be written.
+  static RAJASHAREDDLL_API bool writeVectorStats(const std::string& filename);
 
-  static camp::idx_t num_matrix_mm_mult_row_row;
-  static camp::idx_t num_matrix_mm_multacc_row_row;
-  static camp::idx_t num_matrix_mm_mult_col_col;
-  static camp::idx_t num_matrix_mm_multacc_col_col;
+  //! counters the calling thread counts into, nullptr before it counted
+  static thread_local counter_block* current_block;
 
-  static void resetVectorStats();
-  static void printVectorStats();
+  //! Make the counters of the calling thread, returns its current block.
+  static RAJASHAREDDLL_API counter_block* registerThread();
 
 };
 
@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <iterator>
 #include <tuple>
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -174,6 +175,10 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
     if (offset == size - index - 1) {
 
       util::PluginContext context{util::make_context<Policy>()};
+      if (context.hooks_active) {
+        using std::begin; using std::end; using std::distance;
+        context.num_iterations = static_cast<long long>(distance(begin(iter), end(iter)));
+      }
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
@@ -205,6 +210,10 @@ struct policy_invoker<0, size, Policy, rest...> {
     if (offset == size - 1) {
 
       util::PluginContext context{util::make_context<Policy>()};
+      if (context.hooks_active) {
+        using std::begin; using std::end; using std::distance;
+        context.num_iterations = static_cast<long long>(distance(begin(iter), end(iter)));
+      }
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
@@ -32,6 +32,7 @@ enum class Policy {
   simd,
   openmp,
   target_openmp,
+  thread_pool,
   cuda,
   hip,
   sycl
@@ -121,6 +122,9 @@ namespace reduce
 struct ordered {
 };
 
+struct reproducible {
+};
+
 }  // namespace reduce
 
 
@@ -184,6 +188,10 @@ struct is_target_openmp_policy
     : RAJA::policy_is<Pol, RAJA::Policy::target_openmp> {
 };
 template <typename Pol>
+struct is_thread_pool_policy
+    : RAJA::policy_is<Pol, RAJA::Policy::thread_pool> {
+};
+template <typename Pol>
 struct is_cuda_policy : RAJA::policy_is<Pol, RAJA::Policy::cuda> {
 };
 template <typename Pol>
@@ -26,6 +26,10 @@
     #include "RAJA/policy/sequential/atomic.hpp"
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+#include "RAJA/policy/atomic_builtin.hpp"
+#endif
+
 /*!
  * Provides priority between atomic policies that should do the "right thing"
  *
@@ -35,6 +39,8 @@
  * Next, if OpenMP is enabled we always use the omp_atomic, which should
  * generally work everywhere.
  *
+ * Otherwise, if the thread pool back-end is enabled we use builtin_atomic.
+ *
  * Finally, we fallback on the seq_atomic, which performs non-atomic operations
  * because we assume there is no thread safety issues (no parallel model)
  */
@@ -50,6 +56,9 @@
 #elif defined(RAJA_ENABLE_OPENMP)
 #define RAJA_AUTO_ATOMIC \
   RAJA::omp_atomic {}
+#elif defined(RAJA_ENABLE_THREAD_POOL)
+#define RAJA_AUTO_ATOMIC \
+  RAJA::builtin_atomic {}
 #else
 #define RAJA_AUTO_ATOMIC \
   RAJA::seq_atomic {}
@@ -34,6 +34,7 @@
 #endif
 
 #include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/MemUtils_OpenMP.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
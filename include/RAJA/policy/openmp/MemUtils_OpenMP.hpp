@@ -0,0 +1,265 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing host allocators that place memory across
+ *          NUMA domains with OpenMP threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_MemUtils_OpenMP_HPP
+#define RAJA_MemUtils_OpenMP_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+namespace omp
+{
+
+//! How the pages of host memory are placed across NUMA domains
+enum struct Placement {
+  //! each page is first touched by the thread that owns it in a static
+  //! partition of the elements, as in omp_parallel_for_static_exec loops
+  first_touch,
+  //! pages, or huge pages, are first touched by the threads in turn
+  interleave
+};
+
+//! pages are touched at this granularity, small enough for any OS page
+constexpr size_t placement_page_size = 4096;
+
+namespace detail
+{
+
+//! touch the page holding ptr by writing back the byte it reads, so the
+//! contents of memory that is already in use are kept
+inline void touch_page(char* ptr)
+{
+  volatile char* byte = ptr;
+  *byte = *byte;
+}
+
+}  // namespace detail
+
+///
+/// Place the memory of num elements of elem_size bytes starting at ptr by
+/// touching every page from OpenMP threads. Placement follows the first touch
+/// policy of the OS, so it only takes effect for memory not yet touched and
+/// threads should be bound to cores, for example with OMP_PROC_BIND.
+///
+/// Each page is touched by writing back one of its bytes, so the contents
+/// of the memory are kept, but no other thread may write the memory while
+/// it is placed.
+///
+/// interleave_size is the size of the blocks dealt to the threads in turn
+/// for Placement::interleave.
+///
+inline void place_pages(void* ptr,
+                        size_t num,
+                        size_t elem_size,
+                        Placement placement,
+                        size_t interleave_size = placement_page_size)
+{
+  char* const begin = static_cast<char*>(ptr);
+  char* const end = begin + num * elem_size;
+  if (begin == end) {
+    return;
+  }
+
+  const uintptr_t page_mask = placement_page_size - 1;
+  char* const first_page = reinterpret_cast<char*>(
+      reinterpret_cast<uintptr_t>(begin) & ~page_mask);
+
+  if (placement == Placement::interleave) {
+
+    const size_t num_blocks =
+        (static_cast<size_t>(end - first_page) + interleave_size - 1) /
+        interleave_size;
+
+    RAJA::forall<RAJA::omp_parallel_for_static_exec<1>>(
+        RAJA::TypedRangeSegment<size_t>(0, num_blocks), [=](size_t b) {
+          char* page = first_page + b * interleave_size;
+          char* block_end = page + interleave_size;
+          if (block_end > end) {
+            block_end = end;
+          }
+          for (; page < block_end; page += placement_page_size) {
+            detail::touch_page(page < begin ? begin : page);
+          }
+        });
+
+  } else {
+
+    // every element touches the pages that start inside it, the first
+    // element also touches the page it starts in
+    RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+        RAJA::TypedRangeSegment<size_t>(0, num), [=](size_t i) {
+          char* elem_begin = begin + i * elem_size;
+          char* elem_end = elem_begin + elem_size;
+          char* page = reinterpret_cast<char*>(
+              (reinterpret_cast<uintptr_t>(elem_begin) + page_mask) &
+              ~page_mask);
+          if (i == 0) {
+            detail::touch_page(elem_begin);
+          }
+          for (; page < elem_end; page += placement_page_size) {
+            detail::touch_page(page);
+          }
+        });
+  }
+}
+
+namespace detail
+{
+
+//! allocate nbytes of host memory and place it
+inline void* allocate_placed(size_t num,
+                             size_t elem_size,
+                             Placement placement,
+                             bool huge_pages)
+{
+  const size_t nbytes = num * elem_size;
+  void* ptr = huge_pages
+                  ? allocate_huge_pages(nbytes)
+                  : allocate_aligned(placement_page_size,
+                                     (nbytes + placement_page_size - 1) /
+                                         placement_page_size *
+                                         placement_page_size);
+  if (ptr != nullptr) {
+    place_pages(ptr,
+                num,
+                elem_size,
+                placement,
+                huge_pages ? huge_page_size : placement_page_size);
+  }
+  return ptr;
+}
+
+inline void free_placed(void* ptr, bool huge_pages)
+{
+  if (huge_pages) {
+    free_huge_pages(ptr);
+  } else {
+    free_aligned(ptr);
+  }
+}
+
+}  // namespace detail
+
+///
+/// Allocator for placed host memory for use in basic_mempool. The pool hands
+/// out pieces of its arenas, so Placement::interleave is usually the better
+/// choice here, first touch places each arena as a byte array.
+///
+template <Placement placement, bool huge_pages = true>
+struct PlacedHostAllocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    return detail::allocate_placed(nbytes, 1, placement, huge_pages);
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    detail::free_placed(ptr, huge_pages);
+    return true;
+  }
+};
+
+///
+/// Standard library style allocator for placed host memory, for example for
+/// WorkPool storage or containers of large arrays. With
+/// Placement::first_touch the pages of an array of T are placed on the
+/// threads that access them in omp_parallel_for_static_exec loops over the
+/// array with the same number of threads.
+///
+template <typename T, Placement placement, bool huge_pages = true>
+struct placed_host_allocator {
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = placed_host_allocator<U, placement, huge_pages>;
+  };
+
+  placed_host_allocator() = default;
+
+  template <typename U>
+  placed_host_allocator(
+      placed_host_allocator<U, placement, huge_pages> const&) noexcept
+  {
+  }
+
+  /*[[nodiscard]]*/
+  value_type* allocate(size_t num)
+  {
+    if (num > static_cast<size_t>(-1) / sizeof(value_type)) {
+      throw std::bad_alloc();
+    }
+    void* ptr = detail::allocate_placed(num,
+                                        sizeof(value_type),
+                                        placement,
+                                        huge_pages);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<value_type*>(ptr);
+  }
+
+  void deallocate(value_type* ptr, size_t) noexcept
+  {
+    detail::free_placed(ptr, huge_pages);
+  }
+
+  template <typename U>
+  friend inline bool operator==(
+      placed_host_allocator const&,
+      placed_host_allocator<U, placement, huge_pages> const&)
+  {
+    return true;
+  }
+
+  template <typename U>
+  friend inline bool operator!=(
+      placed_host_allocator const&,
+      placed_host_allocator<U, placement, huge_pages> const&)
+  {
+    return false;
+  }
+};
+
+}  // namespace omp
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
@@ -20,8 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/region.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -81,6 +88,197 @@ struct WorkRunner<
         Args...>
 { };
 
+
+/*!
+ * A body and segment holder for storing loops whose iterations are split
+ * among the threads of an OpenMP parallel region
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpLoopIterRange
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpLoopIterRange(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  // run iterations [i_begin, i_end) of the loop with a private loop body
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(m_body);
+    auto& body = privatizer.get_priv();
+
+    const auto begin = m_segment.begin();
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order in a single OpenMP parallel
+ * region. The iterations of all the loops are numbered consecutively and
+ * each thread runs an equal contiguous share of them, so a thread may run
+ * the end of one loop and the start of the next. The threads only
+ * synchronize when the parallel region ends.
+ */
+template <typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_region_iter_balanced,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_region_iter_balanced;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldOmpLoopIterRange<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host
+  using dispatcher_exec_policy = RAJA::seq_work;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::host, dispatcher_holder_policy, order_policy, index_type, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_loop_offsets(std::move(o.m_loop_offsets))
+    , m_total_iterations(o.m_total_iterations)
+  {
+    o.clear();
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_loop_offsets = std::move(o.m_loop_offsets);
+    m_total_iterations = o.m_total_iterations;
+
+    o.clear();
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    const index_type len = std::distance(std::begin(iter), std::end(iter));
+
+    // Only store loops with something to iterate over
+    if (len > 0) {
+
+      // loop offsets are the exclusive prefix sum of the loop lengths
+      m_loop_offsets.push_back(m_total_iterations);
+      m_total_iterations += len;
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    const auto begin = std::begin(storage);
+    const index_type num_loops = std::distance(begin, std::end(storage));
+
+    // Only start a parallel region if we have something to iterate over
+    if (num_loops > 0) {
+
+      const index_type total = m_total_iterations;
+      const index_type* offsets = m_loop_offsets.data();
+
+      RAJA::region<RAJA::omp_parallel_region>([&]() {
+
+        const index_type num_threads = omp_get_num_threads();
+        const index_type tid = omp_get_thread_num();
+
+        index_type i_begin = total / num_threads * tid +
+                             std::min(tid, total % num_threads);
+        const index_type i_end = i_begin + total / num_threads +
+                                 (tid < total % num_threads ? 1 : 0);
+
+        // find the loop containing this thread's first iteration
+        index_type loop = static_cast<index_type>(
+            std::upper_bound(offsets, offsets + num_loops, i_begin) - offsets) - 1;
+
+        while (i_begin < i_end) {
+          const index_type loop_begin = offsets[loop];
+          const index_type loop_end =
+              (loop + 1 < num_loops) ? offsets[loop + 1] : total;
+          const index_type chunk_end = std::min(i_end, loop_end);
+
+          value_type::host_call(&begin[loop],
+                                i_begin - loop_begin, chunk_end - loop_begin,
+                                args...);
+
+          i_begin = chunk_end;
+          ++loop;
+        }
+      });
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_loop_offsets.clear();
+    m_total_iterations = 0;
+  }
+
+private:
+  std::vector<index_type> m_loop_offsets;
+  index_type m_total_iterations = 0;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
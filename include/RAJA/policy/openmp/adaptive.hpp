@@ -0,0 +1,169 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the team size selection used by the
+ *          OpenMP omp_adaptive_exec policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_adaptive_openmp_HPP
+#define RAJA_adaptive_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+namespace internal
+{
+
+/*!
+ * \brief Costs measured once per process that decide how many threads an
+ *        omp_adaptive_exec loop uses.
+ */
+struct AdaptiveCalibration {
+  //! time to open and join a parallel region of omp_get_max_threads()
+  //! threads, in nanoseconds
+  double fork_join_ns;
+  //! time of one iteration of y[i] += a * x[i] with data in cache on one
+  //! thread, in nanoseconds; the cost of a KernelCost(24, 2) iteration
+  double iteration_ns;
+};
+
+//! bytes and flops of the iteration timed by AdaptiveCalibration
+constexpr double adaptive_reference_bytes = 24.0;
+constexpr double adaptive_reference_flops = 2.0;
+
+//! cost of an iteration that moves bytes and does flops relative to the
+//! calibrated iteration, 1 if the cost is not known
+inline double adaptive_cost_scale(double bytes, double flops)
+{
+  const double scale = std::max(bytes / adaptive_reference_bytes,
+                                flops / adaptive_reference_flops);
+  return scale > 0.0 ? scale : 1.0;
+}
+
+inline AdaptiveCalibration calibrate_adaptive()
+{
+  using clock = std::chrono::steady_clock;
+  AdaptiveCalibration c;
+
+  // median of regions in which each thread does one iteration, the first
+  // ones start the threads; empty regions may be optimized away
+  constexpr int warmup = 4;
+  constexpr int samples = 31;
+  std::vector<double> times(samples);
+  const int num_threads = omp_get_max_threads();
+  std::vector<int> slots(num_threads, 0);
+  int* slot = slots.data();
+  for (int s = -warmup; s < samples; ++s) {
+    const auto start = clock::now();
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_threads; ++i) {
+      slot[i] += i;
+    }
+    const std::chrono::duration<double, std::nano> t = clock::now() - start;
+    if (s >= 0) {
+      times[s] = t.count();
+    }
+  }
+  std::nth_element(times.begin(), times.begin() + samples / 2, times.end());
+  c.fork_join_ns = times[samples / 2];
+
+  // fastest of a few passes over arrays that fit in the L1 cache
+  constexpr int n = 1024;
+  std::vector<double> x(n, 1.0);
+  std::vector<double> y(n, 0.0);
+  double best = 0.0;
+  for (int rep = 0; rep < 16; ++rep) {
+    const auto start = clock::now();
+    for (int i = 0; i < n; ++i) {
+      y[i] += 1.000001 * x[i];
+    }
+    const std::chrono::duration<double, std::nano> t = clock::now() - start;
+    if (rep == 0 || t.count() < best) {
+      best = t.count();
+    }
+  }
+  volatile double sink = y[n / 2];
+  RAJA_UNUSED_VAR(sink);
+  c.iteration_ns = std::max(best / n, 1.0e-3);
+
+  return c;
+}
+
+//! the calibration, measured on first use
+inline const AdaptiveCalibration& adaptive_calibration()
+{
+  static const AdaptiveCalibration c = calibrate_adaptive();
+  return c;
+}
+
+/*!
+ * \brief Number of threads for a loop of len iterations, each cost_scale
+ *        times the calibrated iteration. 1 means run on the calling thread
+ *        without a parallel region.
+ *
+ *        A team of t threads pays off when each thread gets enough
+ *        iterations to cover the fork/join cost, so t is the loop length
+ *        divided by the fork/join cost in iterations, capped by the number
+ *        of threads OpenMP would use. A positive min_iterations_per_thread
+ *        replaces the calibrated ratio.
+ */
+inline int adaptive_num_threads(Index_type len,
+                                double cost_scale,
+                                int min_iterations_per_thread)
+{
+  const int max_threads = omp_get_max_threads();
+  // a region nested deeper than OpenMP allows would get a single thread
+  if (max_threads <= 1 ||
+      omp_get_active_level() >= omp_get_max_active_levels()) {
+    return 1;
+  }
+
+  double min_per_thread = min_iterations_per_thread;
+  if (min_iterations_per_thread <= 0) {
+    const AdaptiveCalibration& c = adaptive_calibration();
+    min_per_thread = c.fork_join_ns / (c.iteration_ns * cost_scale);
+  }
+  min_per_thread = std::max(min_per_thread, 1.0);
+
+  const double threads = static_cast<double>(len) / min_per_thread;
+  if (threads >= max_threads) {
+    return max_threads;
+  }
+  return std::max(static_cast<int>(threads), 1);
+}
+
+}  // namespace internal
+}  // namespace omp
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
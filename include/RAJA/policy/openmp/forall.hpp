@@ -25,11 +25,14 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <atomic>
 #include <iostream>
 #include <type_traits>
+#include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/basic_mempool.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/internal/fault_tolerance.hpp"
@@ -38,7 +41,10 @@
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/policy/openmp/adaptive.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/static_partition.hpp"
+#include "RAJA/policy/openmp/work_stealing.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -76,6 +82,28 @@ forall_impl(resources::Host host_res,
 }
 
 
+template <typename Iterable, typename Func, typename InnerPolicy,
+          omp_proc_bind Bind, int NumThreads, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_parallel_placed_exec<InnerPolicy, Bind, NumThreads>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  RAJA::region<omp_parallel_placed_region<Bind, NumThreads>>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    forall_impl(host_res, InnerPolicy{}, iter, body.get_priv(), f_params);
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+
 ///
 /// OpenMP parallel for schedule policy implementation
 ///
@@ -101,35 +129,19 @@ namespace internal
   }
 
   //
-  // omp for schedule(static)
-  //
-  template <typename Iterable, typename Func, int ChunkSize,
-    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
-  RAJA_INLINE void forall_impl(const ::RAJA::policy::omp::Static<ChunkSize>&,
-                               Iterable&& iter,
-                               Func&& loop_body)
-  {
-    RAJA_EXTRACT_BED_IT(iter);
-    #pragma omp for schedule(static)
-    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-      loop_body(begin_it[i]);
-    }
-  }
-
-  //
-  // omp for schedule(static, ChunkSize)
+  // omp for schedule(static) and schedule(static, ChunkSize), with the
+  // partition computed by RAJA so it is the same across parallel regions
   //
-  template <typename Iterable, typename Func, int ChunkSize,
-    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  template <typename Iterable, typename Func, int ChunkSize>
   RAJA_INLINE void forall_impl(const ::RAJA::policy::omp::Static<ChunkSize>&,
                                Iterable&& iter,
                                Func&& loop_body)
   {
     RAJA_EXTRACT_BED_IT(iter);
-    #pragma omp for schedule(static, ChunkSize)
-    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    static_for<ChunkSize>(distance_it, [&](decltype(distance_it) i) {
       loop_body(begin_it[i]);
-    }
+    });
+    #pragma omp barrier
   }
 
   //
@@ -247,35 +259,17 @@ namespace internal
   }
 
   //
-  // omp for schedule(static) nowait
-  //
-  template <typename Iterable, typename Func, int ChunkSize,
-    typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
-  RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Static<ChunkSize>&,
-                               Iterable&& iter,
-                               Func&& loop_body)
-  {
-    RAJA_EXTRACT_BED_IT(iter);
-    #pragma omp for schedule(static) nowait
-    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-      loop_body(begin_it[i]);
-    }
-  }
-
-  //
-  // omp for schedule(static, ChunkSize) nowait
+  // omp for schedule(static) nowait and schedule(static, ChunkSize) nowait
   //
-  template <typename Iterable, typename Func, int ChunkSize,
-    typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
+  template <typename Iterable, typename Func, int ChunkSize>
   RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Static<ChunkSize>&,
                                Iterable&& iter,
                                Func&& loop_body)
   {
     RAJA_EXTRACT_BED_IT(iter);
-    #pragma omp for schedule(static, ChunkSize) nowait
-    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+    static_for<ChunkSize>(distance_it, [&](decltype(distance_it) i) {
       loop_body(begin_it[i]);
-    }
+    });
   }
 
   //TODO :: not implemented in param interface...
@@ -295,6 +289,45 @@ namespace internal
   }
   #endif
 
+
+  /// Tag dispatch for omp forall with simd
+
+  //
+  // omp for simd simdlen(SimdLen) (Auto)
+  //
+  template <int SimdLen, typename Iterable, typename Func>
+  RAJA_INLINE void forall_simd_impl(const ::RAJA::policy::omp::Auto&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+  #if defined(RAJA_COMPILER_MSVC)
+    #pragma omp for
+  #else
+    #pragma omp for simd simdlen(SimdLen)
+  #endif
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      loop_body(begin_it[i]);
+    }
+  }
+
+  //
+  // omp for simd schedule(simd:static) and schedule(simd:static, ChunkSize),
+  // with the partition computed by RAJA so it is the same across parallel
+  // regions
+  //
+  template <int SimdLen, typename Iterable, typename Func, int ChunkSize>
+  RAJA_INLINE void forall_simd_impl(const ::RAJA::policy::omp::Static<ChunkSize>&,
+                               Iterable&& iter,
+                               Func&& loop_body)
+  {
+    RAJA_EXTRACT_BED_IT(iter);
+    static_simd_for<ChunkSize, SimdLen>(distance_it, [&](decltype(distance_it) i) {
+      loop_body(begin_it[i]);
+    });
+    #pragma omp barrier
+  }
+
 } // end namespace internal
 
 template <typename Schedule, typename Iterable, typename Func, typename ForallParam>
@@ -329,6 +362,93 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+template <typename Schedule, int SimdLen, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_for_simd_schedule_exec<Schedule, SimdLen>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  internal::forall_simd_impl<SimdLen>(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body));
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP work-stealing policy implementation
+///
+template <int ChunkSize, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_work_stealing_exec<ChunkSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  internal::WorkStealingRanges ranges(distance_it, ChunkSize);
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    ranges.run([&](Index_type b, Index_type e) {
+      for (Index_type i = b; i < e; ++i) {
+        body.get_priv()(begin_it[i]);
+      }
+    });
+  });
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP adaptive team size policy implementation
+///
+template <int MinIterationsPerThread, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_adaptive_exec<MinIterationsPerThread>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+  const int num_threads =
+      internal::adaptive_num_threads(distance_it, 1.0, MinIterationsPerThread);
+
+  using RAJA::internal::thread_privatize;
+  if (num_threads <= 1) {
+    auto body = thread_privatize(loop_body);
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      body.get_priv()(begin_it[i]);
+    }
+  } else {
+    const util::PluginContext* plugin_context = util::current_plugin_context();
+    #pragma omp parallel num_threads(num_threads)
+    {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      auto body = thread_privatize(loop_body);
+      #pragma omp for schedule(static) nowait
+      for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+        body.get_priv()(begin_it[i]);
+      }
+    }
+  }
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -342,64 +462,198 @@ forall_impl(resources::Host host_res,
 /*!
  ******************************************************************************
  *
- * \brief  Iterate over index set segments using an omp parallel loop and
- *         segment dependency graph. Individual segment execution will use
- *         execution policy template parameter.
+ * \brief  Reload the semaphore of segment seg of a task graph traversal,
+ *         run it and satisfy the segments that depend on it.
  *
- *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         Dependents whose last dependency was seg are ready unless they
+ *         already started in this traversal, in which case the satisfied
+ *         dependency counts toward the next traversal. The first ready
+ *         dependent runs next on this thread and the others are launched
+ *         as OpenMP tasks, so no thread ever waits on a semaphore.
  *
  ******************************************************************************
  */
+template <typename IndexSetType, typename RunSegment>
+void taskgraph_run(IndexSetType const* iset,
+                   std::atomic<bool>* started,
+                   RunSegment const* run_segment,
+                   int seg)
+{
+  while (seg >= 0) {
+    DepGraphNode* task = iset->getDepGraphNode(seg);
+    task->reload();
+
+    (*run_segment)(seg);
+
+    int next = -1;
+    const int num_dep = task->numDepTasks();
+    for (int ii = 0; ii < num_dep; ++ii) {
+      int dep = task->depTaskNum(ii);
+      if (iset->getDepGraphNode(dep)->satisfyOne() == 0 &&
+          !started[dep].exchange(true)) {
+        if (next < 0) {
+          next = dep;
+        } else {
+#pragma omp task firstprivate(iset, started, run_segment, dep)
+          taskgraph_run(iset, started, run_segment, dep);
+        }
+      }
+    }
+    seg = next;
+  }
+}
 
-/*
- * TODO: Fix this!!!
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments in the order given by the index
+ *         set dependency graph. Individual segment execution will use
+ *         execution policy template parameter.
+ *
+ *         Segments whose semaphore is zero when the traversal starts are
+ *         shared among the threads. Every other segment is launched as an
+ *         OpenMP task by the segment that satisfies its last dependency.
+ *         Each segment runs once per traversal; dependencies satisfied
+ *         after a segment started count toward the next traversal, which
+ *         allows graphs that pipeline successive traversals.
+ *
+ ******************************************************************************
  */
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskgraph_segit&,
+            Iterable&& iset,
+            Func&& loop_body,
+            ForallParam)
+{
+  static_assert(type_traits::is_index_set<Iterable>::value,
+                "omp_taskgraph_segit can only iterate over index sets");
+
+  if (!iset.dependencyGraphSet()) {
+    RAJA_ABORT_OR_THROW("omp_taskgraph_segit requires an IndexSet dependency graph");
+  }
+
+  // gather the ready segments before any segment can satisfy another
+  const int num_seg = iset.getNumSegments();
+  std::vector<std::atomic<bool>> started(num_seg);
+  std::vector<int> ready;
+  for (int seg = 0; seg < num_seg; ++seg) {
+    const bool is_ready = iset.getDepGraphNode(seg)->semaphoreValue() <= 0;
+    started[seg].store(is_ready, std::memory_order_relaxed);
+    if (is_ready) {
+      ready.push_back(seg);
+    }
+  }
+  const int num_ready = ready.size();
+
+  using RAJA::internal::thread_privatize;
+  using body_type =
+      camp::decay<decltype(thread_privatize(loop_body).get_priv())>;
+  std::vector<body_type*> bodies(omp_get_max_threads(), nullptr);
 
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+  // tasks use the loop body privatized by the thread executing them
+  auto run_segment = [&](int seg) { (*bodies[omp_get_thread_num()])(seg); };
+
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    auto body = thread_privatize(loop_body);
+    bodies[omp_get_thread_num()] = &body.get_priv();
+#pragma omp barrier
+
+#pragma omp for schedule(dynamic, 1) nowait
+    for (int r = 0; r < num_ready; ++r) {
+      taskgraph_run(&iset, started.data(), &run_segment, ready[r]);
+    }
+
+    // all tasks complete here, before the private bodies are destroyed
+#pragma omp barrier
+  });
+
+  for (int seg = 0; seg < num_seg; ++seg) {
+    if (!started[seg].load(std::memory_order_relaxed)) {
+      RAJA_ABORT_OR_THROW("omp_taskgraph_segit did not run every segment, "
+                          "check the IndexSet dependency graph");
+    }
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using the index set segment
+ *         intervals and dependency graph. Individual segment execution will
+ *         use execution policy template parameter.
+ *
+ *         Thread t executes the segments of intervals t, t + num_threads,
+ *         ... in order, waiting on each segment's semaphore before running
+ *         it. If no intervals are set, each thread gets one contiguous
+ *         block of segments. The graph must be built for this schedule or
+ *         threads will wait forever.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskgraph_interval_segit&,
+            Iterable&& iset,
+            Func&& loop_body,
+            ForallParam)
 {
+  static_assert(type_traits::is_index_set<Iterable>::value,
+                "omp_taskgraph_interval_segit can only iterate over index sets");
+
   if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+    RAJA_ABORT_OR_THROW("omp_taskgraph_interval_segit requires an IndexSet dependency graph");
   }
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  const int num_seg = iset.getNumSegments();
+  const int num_intervals = iset.getNumSegmentIntervals();
 
-  int num_seg = ncis.getNumSegments();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+    const int num_threads = omp_get_num_threads();
+    const int tid = omp_get_thread_num();
 
-    task->wait();
+    const int my_intervals = num_intervals > 0 ? num_intervals : num_threads;
+    for (int ival = tid; ival < my_intervals; ival += num_threads) {
+      const int begin = num_intervals > 0
+                            ? iset.getSegmentIntervalBegin(ival)
+                            : static_cast<int>(Index_type(ival) * num_seg / num_threads);
+      const int end = num_intervals > 0
+                          ? iset.getSegmentIntervalEnd(ival)
+                          : static_cast<int>(Index_type(ival + 1) * num_seg / num_threads);
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+      for (int seg = begin; seg < end; ++seg) {
+        DepGraphNode* task = iset.getDepGraphNode(seg);
 
-    task->reset();
+        task->wait();
+        task->reload();
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
+        body.get_priv()(seg);
+
+        const int num_dep = task->numDepTasks();
+        for (int ii = 0; ii < num_dep; ++ii) {
+          iset.getDepGraphNode(task->depTaskNum(ii))->satisfyOne();
+        }
       }
     }
+  });
 
-  }  // iterate over segments of index set
+  return resources::EventProxy<resources::Host>(host_res);
 }
-*/
 
 }  // namespace omp
 
@@ -28,6 +28,7 @@
 #include "RAJA/pattern/kernel/internal.hpp"
 
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
@@ -71,8 +72,11 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1) firstprivate(privatizer) \
-    RAJA_COLLAPSE(2)
+    const util::PluginContext* plugin_context = util::current_plugin_context();
+#pragma omp parallel private(i0, i1) firstprivate(privatizer)
+    {
+    util::PluginThreadScope plugin_scope(plugin_context);
+#pragma omp for nowait RAJA_COLLAPSE(2)
     for (i0 = 0; i0 < l0; ++i0) {
       for (i1 = 0; i1 < l1; ++i1) {
         auto& private_data = privatizer.get_priv();
@@ -81,6 +85,7 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
         execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(private_data);
       }
     }
+    }
   }
 };
 
@@ -112,8 +117,11 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(data);
-#pragma omp parallel for private(i0, i1, i2) firstprivate(privatizer) \
-    RAJA_COLLAPSE(3)
+    const util::PluginContext* plugin_context = util::current_plugin_context();
+#pragma omp parallel private(i0, i1, i2) firstprivate(privatizer)
+    {
+    util::PluginThreadScope plugin_scope(plugin_context);
+#pragma omp for nowait RAJA_COLLAPSE(3)
     for (i0 = 0; i0 < l0; ++i0) {
       for (i1 = 0; i1 < l1; ++i1) {
         for (i2 = 0; i2 < l2; ++i2) {
@@ -125,6 +133,7 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
         }
       }
     }
+    }
   }
 };
 
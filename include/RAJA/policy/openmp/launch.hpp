@@ -20,6 +20,8 @@
 
 #include "RAJA/pattern/launch/launch_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/static_partition.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 namespace RAJA
 {
@@ -40,11 +42,11 @@ struct LaunchExecute<RAJA::omp_launch_t> {
         using RAJA::internal::thread_privatize;
         auto loop_body = thread_privatize(body);
 
-        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+        ThreadScratch shared_mem(params.shared_mem_size);
+        ctx.shared_mem_ptr = shared_mem.get();
 
         loop_body.get_priv()(ctx);
 
-        free(ctx.shared_mem_ptr);
         ctx.shared_mem_ptr = nullptr;
     });
 
@@ -66,17 +68,23 @@ struct LaunchExecute<RAJA::omp_launch_t> {
     //reducer object must be named f_params as expected by macro below
     RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
+    const util::PluginContext* plugin_context = util::current_plugin_context();
+
    #pragma omp parallel reduction(combine : f_params)
     {
+      util::PluginThreadScope plugin_scope(plugin_context);
 
       LaunchContext ctx;
 
       using RAJA::internal::thread_privatize;
       auto loop_body = thread_privatize(body);
 
-      ctx.shared_mem_ptr = (char*) malloc(launch_params.shared_mem_size);
+      ThreadScratch shared_mem(launch_params.shared_mem_size);
+      ctx.shared_mem_ptr = shared_mem.get();
 
       expt::invoke_body(f_params, loop_body.get_priv(), ctx);
+
+      ctx.shared_mem_ptr = nullptr;
     }
 
     expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -302,6 +310,297 @@ struct LoopICountExecute<omp_for_exec, SEGMENT> {
   }
 };
 
+//
+// 'omp for simd' over the segment, for multiple segments 'omp for' over the
+// outer segments and simd over the first one
+//
+template <int SimdLen, typename SEGMENT>
+struct LoopExecute<omp_for_simd_schedule_exec<policy::omp::Auto, SimdLen>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    int len = segment.end() - segment.begin();
+#if defined(RAJA_COMPILER_MSVC)
+#pragma omp for
+#else
+#pragma omp for simd simdlen(SimdLen)
+#endif
+    for (int i = 0; i < len; i++) {
+
+      body(*(segment.begin() + i));
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+    for (int j = 0; j < len1; j++) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+    for (int k = 0; k < len2; k++) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    }
+  }
+};
+
+template <int SimdLen, typename SEGMENT>
+struct LoopICountExecute<omp_for_simd_schedule_exec<policy::omp::Auto, SimdLen>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    int len = segment.end() - segment.begin();
+
+#if defined(RAJA_COMPILER_MSVC)
+#pragma omp for
+#else
+#pragma omp for simd simdlen(SimdLen)
+#endif
+      for (int i = 0; i < len; i++) {
+        body(*(segment.begin() + i), i);
+      }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               i,
+               j);
+        }
+      }
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+#pragma omp for
+      for (int k = 0; k < len2; k++) {
+        for (int j = 0; j < len1; j++) {
+          RAJA_SIMD
+          for (int i = 0; i < len0; i++) {
+            body(*(segment0.begin() + i),
+                 *(segment1.begin() + j),
+                 *(segment2.begin() + k),
+                 i,
+                 j,
+                 k);
+          }
+        }
+      }
+  }
+};
+
+//
+// 'omp for simd schedule(simd:static[, ChunkSize])' with the partition of
+// the static forall policies, for multiple segments the static schedule over
+// the outer segments and simd over the first one
+//
+template <int ChunkSize, int SimdLen, typename SEGMENT>
+struct LoopExecute<omp_for_simd_schedule_exec<policy::omp::Static<ChunkSize>, SimdLen>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    int len = segment.end() - segment.begin();
+    policy::omp::internal::static_simd_for<ChunkSize, SimdLen>(len, [&](int i) {
+      body(*(segment.begin() + i));
+    });
+#pragma omp barrier
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    policy::omp::internal::static_for<ChunkSize>(len1, [&](int j) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i), *(segment1.begin() + j));
+      }
+    });
+#pragma omp barrier
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    policy::omp::internal::static_for<ChunkSize>(len2, [&](int k) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k));
+        }
+      }
+    });
+#pragma omp barrier
+  }
+};
+
+template <int ChunkSize, int SimdLen, typename SEGMENT>
+struct LoopICountExecute<omp_for_simd_schedule_exec<policy::omp::Static<ChunkSize>, SimdLen>, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment,
+      BODY const &body)
+  {
+
+    int len = segment.end() - segment.begin();
+    policy::omp::internal::static_simd_for<ChunkSize, SimdLen>(len, [&](int i) {
+      body(*(segment.begin() + i), i);
+    });
+#pragma omp barrier
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      BODY const &body)
+  {
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    policy::omp::internal::static_for<ChunkSize>(len1, [&](int j) {
+      RAJA_SIMD
+      for (int i = 0; i < len0; i++) {
+
+        body(*(segment0.begin() + i),
+             *(segment1.begin() + j),
+             i,
+             j);
+      }
+    });
+#pragma omp barrier
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(
+      LaunchContext const RAJA_UNUSED_ARG(&ctx),
+      SEGMENT const &segment0,
+      SEGMENT const &segment1,
+      SEGMENT const &segment2,
+      BODY const &body)
+  {
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    policy::omp::internal::static_for<ChunkSize>(len2, [&](int k) {
+      for (int j = 0; j < len1; j++) {
+        RAJA_SIMD
+        for (int i = 0; i < len0; i++) {
+          body(*(segment0.begin() + i),
+               *(segment1.begin() + j),
+               *(segment2.begin() + k),
+               i,
+               j,
+               k);
+        }
+      }
+    });
+#pragma omp barrier
+  }
+};
+
 // policy for perfectly nested loops
 struct omp_parallel_nested_for_exec;
 
@@ -8,6 +8,11 @@
 #ifndef RAJA_forall_param_openmp_HPP
 #define RAJA_forall_param_openmp_HPP
 
+#include "RAJA/policy/openmp/adaptive.hpp"
+#include "RAJA/policy/openmp/static_partition.hpp"
+#include "RAJA/policy/openmp/work_stealing.hpp"
+#include "RAJA/util/basic_mempool.hpp"
+
 namespace RAJA
 {
 
@@ -36,46 +41,27 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
-
-      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
-    }
-
-    //
-    // omp for schedule(static)
-    //
-    template <template<int> class ExecPol, typename Iterable, typename Func, int ChunkSize, typename ForallParam>
-    RAJA_INLINE 
-    concepts::enable_if< std::is_same<ExecPol<ChunkSize>, RAJA::policy::omp::Static<ChunkSize>>,
-                         std::integral_constant<bool,(ChunkSize <= 0)> >
-    forall_impl(const ExecPol<ChunkSize>& p,
-                                 Iterable&& iter,
-                                 Func&& loop_body,
-                                 ForallParam&& f_params)
-    {
-      using EXEC_POL = typename std::decay<decltype(p)>::type;
-      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
-      RAJA_OMP_DECLARE_REDUCTION_COMBINE;
-
-      RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(static) reduction(combine : f_params)
-      for (decltype(distance_it) i = 0; i < distance_it; ++i) {
-        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
 
     //
-    // omp for schedule(static, ChunkSize)
+    // omp for schedule(static) and schedule(static, ChunkSize), with the
+    // partition computed by RAJA so it is the same across parallel regions
     //
     template <template<int> class ExecPol, typename Iterable, typename Func, int ChunkSize, typename ForallParam>
     RAJA_INLINE 
-    concepts::enable_if< std::is_same<ExecPol<ChunkSize>, RAJA::policy::omp::Static<ChunkSize>>,
-                         std::integral_constant<bool,(ChunkSize > 0)> >
+    concepts::enable_if< std::is_same<ExecPol<ChunkSize>, RAJA::policy::omp::Static<ChunkSize>> >
     forall_impl(const ExecPol<ChunkSize>& p,
                                  Iterable&& iter,
                                  Func&& loop_body,
@@ -86,9 +72,14 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(static, ChunkSize) reduction(combine : f_params)
-      for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel reduction(combine : f_params)
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      ::RAJA::policy::omp::internal::static_for<ChunkSize>(distance_it, [&](decltype(distance_it) i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+      });
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
@@ -108,10 +99,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(runtime) reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(runtime) reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
+      }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
@@ -130,8 +127,11 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
+      const util::PluginContext* plugin_context = util::current_plugin_context();
 #pragma omp parallel
       {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
       #pragma omp for nowait reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
@@ -156,10 +156,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(dynamic) reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(dynamic) reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
+      }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
@@ -179,10 +185,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(dynamic, ChunkSize) reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(dynamic, ChunkSize) reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
+      }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
@@ -202,10 +214,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(guided) reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(guided) reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
+      }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
@@ -225,19 +243,24 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-      #pragma omp parallel for schedule(guided, ChunkSize) reduction(combine : f_params)
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(guided, ChunkSize) reduction(combine : f_params)
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
+      }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
 
     //
-    // omp for schedule(static) nowait
+    // omp for schedule(static) nowait and schedule(static, ChunkSize) nowait
     //
-    template <typename Iterable, typename Func, int ChunkSize, typename ForallParam,
-      typename std::enable_if<(ChunkSize <= 0)>::type* = nullptr>
+    template <typename Iterable, typename Func, int ChunkSize, typename ForallParam>
     RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Static<ChunkSize>& p,
                                  Iterable&& iter,
                                  Func&& loop_body,
@@ -248,23 +271,24 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-#pragma omp parallel
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+#pragma omp parallel reduction(combine : f_params)
       {
-      #pragma omp for schedule(static) nowait reduction(combine : f_params)
-      for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      ::RAJA::policy::omp::internal::static_for<ChunkSize>(distance_it, [&](decltype(distance_it) i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
-      }
+      });
       }
 
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
 
     //
-    // omp for schedule(static, ChunkSize) nowait
+    // omp for simd simdlen(SimdLen) (Auto)
     //
-    template <typename Iterable, typename Func, int ChunkSize, typename ForallParam,
-      typename std::enable_if<(ChunkSize > 0)>::type* = nullptr>
-    RAJA_INLINE void forall_impl_nowait(const ::RAJA::policy::omp::Static<ChunkSize>& p,
+    template <int SimdLen, typename Iterable, typename Func, typename ForallParam>
+    RAJA_INLINE void forall_simd_impl(const ::RAJA::policy::omp::Auto& p,
                                  Iterable&& iter,
                                  Func&& loop_body,
                                  ForallParam&& f_params)
@@ -274,9 +298,16 @@ namespace expt
       RAJA_OMP_DECLARE_REDUCTION_COMBINE;
 
       RAJA_EXTRACT_BED_IT(iter);
-#pragma omp parallel
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel
       {
-      #pragma omp for schedule(static, ChunkSize) nowait reduction(combine : f_params)
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+    #if defined(RAJA_COMPILER_MSVC)
+      #pragma omp for nowait reduction(combine : f_params)
+    #else
+      #pragma omp for simd nowait simdlen(SimdLen) reduction(combine : f_params)
+    #endif
       for (decltype(distance_it) i = 0; i < distance_it; ++i) {
         RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
       }
@@ -285,8 +316,64 @@ namespace expt
       RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
     }
 
+    //
+    // omp for simd schedule(simd:static) and schedule(simd:static, ChunkSize),
+    // with the partition computed by RAJA so it is the same across parallel
+    // regions
+    //
+    template <int SimdLen, typename Iterable, typename Func, int ChunkSize, typename ForallParam>
+    RAJA_INLINE void forall_simd_impl(const ::RAJA::policy::omp::Static<ChunkSize>& p,
+                                 Iterable&& iter,
+                                 Func&& loop_body,
+                                 ForallParam&& f_params)
+    {
+      using EXEC_POL = typename std::decay<decltype(p)>::type;
+      RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+      RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+      RAJA_EXTRACT_BED_IT(iter);
+      using index_type = decltype(distance_it);
+      const util::PluginContext* plugin_context = util::current_plugin_context();
+      #pragma omp parallel reduction(combine : f_params)
+      {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      // the blocks are looped over here rather than in static_for_blocks, so
+      // the simd reduction names the private f_params of this thread
+      index_type first, chunk, stride;
+      ::RAJA::policy::omp::internal::static_blocks<ChunkSize, SimdLen>(
+          distance_it, omp_get_thread_num(), omp_get_num_threads(), first, chunk, stride);
+      for (index_type b = first; b < distance_it; b += stride) {
+        const index_type e = (distance_it - b > chunk) ? b + chunk : distance_it;
+      #if defined(RAJA_COMPILER_MSVC)
+        for (index_type i = b; i < e; ++i) {
+          RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        }
+      #else
+        #pragma omp simd simdlen(SimdLen) reduction(combine : f_params)
+        for (index_type i = b; i < e; ++i) {
+          RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+        }
+      #endif
+      }
+      }
+
+      RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+    }
+
   } //  namespace internal
 
+  template <typename Schedule, int SimdLen, typename Iterable, typename Func, typename ForallParam>
+  RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                                 const omp_for_simd_schedule_exec<Schedule, SimdLen>&,
+                                                                 Iterable&& iter,
+                                                                 Func&& loop_body,
+                                                                 ForallParam f_params)
+  {
+    expt::internal::forall_simd_impl<SimdLen>(Schedule{}, std::forward<Iterable>(iter), std::forward<Func>(loop_body), std::forward<ForallParam>(f_params));
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+
   template <typename Schedule, typename Iterable, typename Func, typename ForallParam>
   RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
                                                                  const omp_for_schedule_exec<Schedule>&,
@@ -318,6 +405,149 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel policy with thread placement implementation
+///
+template <typename Iterable, typename Func, typename InnerPolicy,
+          omp_proc_bind Bind, int NumThreads, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_parallel_placed_exec<InnerPolicy, Bind, NumThreads>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = omp_parallel_placed_exec<InnerPolicy, Bind, NumThreads>;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+  // each thread runs the inner 'omp for' on its private copy of the params
+  const util::PluginContext* plugin_context = util::current_plugin_context();
+  auto run = [&](ForallParam& thread_params) {
+    util::PluginThreadScope plugin_scope(plugin_context);
+    RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+    forall_impl(host_res, InnerPolicy{}, iter,
+                [&](auto&& i) {
+                  RAJA::expt::invoke_body(thread_params, loop_body, i);
+                },
+                RAJA::expt::get_empty_forall_param_pack());
+  };
+
+  const int num_threads = NumThreads > 0 ? NumThreads : omp_get_max_threads();
+#if !defined(RAJA_COMPILER_MSVC)
+  if (Bind == omp_proc_bind::close) {
+    #pragma omp parallel num_threads(num_threads) proc_bind(close) reduction(combine : f_params)
+    {
+      run(f_params);
+    }
+  } else if (Bind == omp_proc_bind::spread) {
+    #pragma omp parallel num_threads(num_threads) proc_bind(spread) reduction(combine : f_params)
+    {
+      run(f_params);
+    }
+  } else
+#endif
+  {
+    #pragma omp parallel num_threads(num_threads) reduction(combine : f_params)
+    {
+      run(f_params);
+    }
+  }
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP work-stealing policy implementation
+///
+template <int ChunkSize, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_work_stealing_exec<ChunkSize>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = omp_work_stealing_exec<ChunkSize>;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+  RAJA_EXTRACT_BED_IT(iter);
+  internal::WorkStealingRanges ranges(distance_it, ChunkSize);
+  const util::PluginContext* plugin_context = util::current_plugin_context();
+
+  #pragma omp parallel reduction(combine : f_params)
+  {
+    util::PluginThreadScope plugin_scope(plugin_context);
+    RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+    ranges.run([&](Index_type b, Index_type e) {
+      for (Index_type i = b; i < e; ++i) {
+        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+      }
+    });
+  }
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+///
+/// OpenMP adaptive team size policy implementation
+///
+template <int MinIterationsPerThread, typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_adaptive_exec<MinIterationsPerThread>&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = omp_adaptive_exec<MinIterationsPerThread>;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+  RAJA_EXTRACT_BED_IT(iter);
+  const auto cost = RAJA::expt::get_kernel_cost(f_params);
+  const int num_threads = internal::adaptive_num_threads(
+      distance_it,
+      internal::adaptive_cost_scale(cost.bytes_per_iteration,
+                                    cost.flops_per_iteration),
+      MinIterationsPerThread);
+
+  if (num_threads <= 1) {
+    for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+      RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+    }
+  } else {
+    const util::PluginContext* plugin_context = util::current_plugin_context();
+    #pragma omp parallel num_threads(num_threads)
+    {
+      util::PluginThreadScope plugin_scope(plugin_context);
+      RAJA::basic_mempool::ThreadCacheFlushScope flush_scope;
+      #pragma omp for nowait schedule(static) reduction(combine : f_params)
+      for (decltype(distance_it) i = 0; i < distance_it; ++i) {
+        RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+      }
+    }
+  }
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace omp
 
 }  // namespace policy
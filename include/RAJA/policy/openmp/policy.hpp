@@ -20,6 +20,8 @@
 
 #include <type_traits>
 
+#include "RAJA/config.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 
 // Rely on builtin_atomic when OpenMP can't do the job
@@ -94,6 +96,42 @@ using Guided = internal::Schedule<omp_sched_guided, ChunkSize>;
 struct Runtime : private internal::Schedule<static_cast<omp_sched_t>(-1), default_chunk_size> {
 };
 
+///
+///  Tag for the 'simd' part of 'omp for simd', SimdLen is the preferred
+///  number of iterations executed together, see the OpenMP simdlen clause.
+///
+template <int SimdLen>
+struct Simd {
+  constexpr static int simd_len = SimdLen;
+};
+
+///
+///  Default SimdLen, the number of doubles in RAJA::DATA_ALIGN bytes.
+///
+static constexpr int default_simd_len =
+    RAJA::DATA_ALIGN >= static_cast<int>(sizeof(double))
+        ? RAJA::DATA_ALIGN / static_cast<int>(sizeof(double))
+        : 1;
+
+namespace internal
+{
+    /// Schedules supported by 'omp for simd' policies
+    template <typename Sched>
+    struct is_simd_schedule : std::false_type {};
+
+    template <>
+    struct is_simd_schedule<Auto> : std::true_type {};
+
+    template <int ChunkSize>
+    struct is_simd_schedule<Static<ChunkSize>> : std::true_type {};
+}  // namespace internal
+
+///
+///  Thread affinity of the team of a parallel region, see the OpenMP
+///  proc_bind clause. none leaves it to OMP_PROC_BIND.
+///
+enum class omp_proc_bind { none, close, spread };
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -112,6 +150,20 @@ struct omp_parallel_region
                                             Platform::host> {
 };
 
+///
+///  Struct supporting OpenMP parallel region with a 'proc_bind(Bind)' clause
+///  and, for a positive NumThreads, a 'num_threads(NumThreads)' clause.
+///
+template <omp_proc_bind Bind = omp_proc_bind::none, int NumThreads = 0>
+struct omp_parallel_placed_region
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::region,
+                                            Launch::undefined,
+                                            Platform::host> {
+  constexpr static omp_proc_bind proc_bind = Bind;
+  constexpr static int num_threads = NumThreads;
+};
+
 ///
 ///  Struct supporting OpenMP parallel region for Teams
 ///
@@ -153,6 +205,22 @@ struct omp_for_schedule_exec : make_policy_pattern_launch_platform_t<Policy::ope
         "Schedule type must be one of: Auto|Runtime|Static|Dynamic|Guided");
 };
 
+///
+///  Struct supporting OpenMP 'for simd schedule( ) simdlen(SimdLen)'
+///
+template <typename Sched, int SimdLen = default_simd_len>
+struct omp_for_simd_schedule_exec : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                                              Pattern::forall,
+                                                              Launch::undefined,
+                                                              Platform::host,
+                                                              omp::For,
+                                                              omp::Simd<SimdLen>,
+                                                              Sched> {
+    static_assert(internal::is_simd_schedule<Sched>::value,
+        "Schedule type must be one of: Auto|Static");
+    static_assert(SimdLen > 0, "SimdLen must be positive");
+};
+
 ///
 ///  Internal type aliases supporting 'omp for schedule( )' for specific
 ///  schedule types.
@@ -191,6 +259,17 @@ using omp_for_runtime_exec = omp_for_schedule_exec<omp::Runtime>;
 template <int ChunkSize = default_chunk_size>
 using omp_for_nowait_static_exec = omp_for_nowait_schedule_exec<omp::Static<ChunkSize>>;
 
+///
+///  Internal type aliases supporting 'omp for simd'. The static schedule
+///  aligns the start of each thread's block, and a ChunkSize, to SimdLen
+///  iterations.
+///
+using omp_for_simd_exec = omp_for_simd_schedule_exec<Auto>;
+
+///
+template <int ChunkSize = default_chunk_size, int SimdLen = default_simd_len>
+using omp_for_simd_static_exec = omp_for_simd_schedule_exec<omp::Static<ChunkSize>, SimdLen>;
+
 ///
 ///  Struct supporting OpenMP 'parallel' region containing an inner loop
 ///  execution construct.
@@ -203,6 +282,22 @@ using omp_parallel_exec = make_policy_pattern_launch_platform_t<Policy::openmp,
                                             omp::Parallel,
                                             wrapper<InnerPolicy>>;
 
+///
+///  Struct supporting OpenMP 'parallel' region with thread placement
+///  clauses, see omp_parallel_placed_region, containing an inner loop
+///  execution construct.
+///
+template <typename InnerPolicy,
+          omp_proc_bind Bind = omp_proc_bind::none,
+          int NumThreads = 0>
+using omp_parallel_placed_exec = make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel,
+                                            wrapper<InnerPolicy>,
+                                            omp_parallel_placed_region<Bind, NumThreads>>;
+
 ///
 ///  Internal type aliases supporting 'omp parallel for schedule( )' for 
 ///  specific schedule types.
@@ -224,6 +319,64 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 ///
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
+///
+///  Internal type aliases supporting 'omp parallel for simd schedule( )'.
+///
+using omp_parallel_for_simd_exec = omp_parallel_exec<omp_for_simd_exec>;
+
+///
+template <int ChunkSize = default_chunk_size, int SimdLen = default_simd_len>
+using omp_parallel_for_simd_static_exec = omp_parallel_exec<omp_for_simd_static_exec<ChunkSize, SimdLen>>;
+
+///
+///  'omp parallel for schedule(static, ChunkSize)' with thread placement
+///  clauses, see omp_parallel_placed_region.
+///
+template <omp_proc_bind Bind,
+          int NumThreads = 0,
+          int ChunkSize = default_chunk_size>
+using omp_parallel_for_static_placed_exec =
+    omp_parallel_placed_exec<omp_for_schedule_exec<omp::Static<ChunkSize>>,
+                             Bind,
+                             NumThreads>;
+
+
+///
+///  Struct supporting an OpenMP parallel region with work-stealing loop
+///  scheduling. Each thread starts with a contiguous block of iterations
+///  that it executes in chunks of ChunkSize; a thread that runs out of work
+///  steals the back half of the remaining block of a randomly chosen thread.
+///  A non-positive ChunkSize selects a chunk size from the loop length.
+///
+template <int ChunkSize = default_chunk_size>
+struct omp_work_stealing_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  constexpr static int chunk_size = ChunkSize;
+};
+
+///
+///  Struct supporting an OpenMP 'parallel for schedule(static)' whose team
+///  size adapts to the loop length. Each thread gets at least as many
+///  iterations as cover the cost of opening the parallel region, measured
+///  on first use against the cost of a cheap iteration scaled by an
+///  expt::KernelCost parameter when one is given; loops too short for two
+///  threads run on the calling thread without opening a region. A positive
+///  MinIterationsPerThread replaces the measured threshold.
+///
+template <int MinIterationsPerThread = 0>
+struct omp_adaptive_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+  constexpr static int min_iterations_per_thread = MinIterationsPerThread;
+};
+
 
 ///
 ///////////////////////////////////////////////////////////////////////
@@ -268,6 +421,15 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+/// execute the enqueued loops in an unordered fashion in a single parallel
+/// region by giving each thread an equal contiguous share of the iterations
+/// of all the loops, found with a prefix sum of the loop lengths
+struct unordered_omp_region_iter_balanced
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -283,6 +445,14 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+///  Reduction policy whose floating-point sums are bitwise identical for
+///  any thread count, schedule, or host loop execution policy.
+///
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::reproducible> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -329,6 +499,16 @@ using policy::omp::omp_parallel_for_dynamic_exec;
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+///
+using policy::omp::omp_parallel_for_static_placed_exec;
+///
+using policy::omp::omp_parallel_for_simd_exec;
+///
+using policy::omp::omp_parallel_for_simd_static_exec;
+///
+using policy::omp::omp_work_stealing_exec;
+///
+using policy::omp::omp_adaptive_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -337,11 +517,23 @@ using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
 
+///
+/// Type aliases for omp iteration over indexset segments ordered by the
+/// indexset dependency graph
+///
+using policy::omp::omp_taskgraph_segit;
+///
+using policy::omp::omp_taskgraph_interval_segit;
+
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
 /// execution policy. Inner policy types follow.
 ///
 using policy::omp::omp_parallel_exec;
+///
+using policy::omp::omp_parallel_placed_exec;
+///
+using policy::omp::omp_proc_bind;
 
 ///
 /// Type alias for 'omp for' loop execution within an omp_parallel_exec construct
@@ -377,10 +569,21 @@ using policy::omp::omp_for_guided_exec;
 ///
 using policy::omp::omp_for_runtime_exec;
 
+///
+/// Type aliases for 'omp for simd' loop execution within an
+/// omp_parallel_exec construct
+///
+using policy::omp::omp_for_simd_schedule_exec;
+///
+using policy::omp::omp_for_simd_exec;
+///
+using policy::omp::omp_for_simd_static_exec;
+
 ///
 /// Type aliases for omp parallel region
 ///
 using policy::omp::omp_parallel_region;
+using policy::omp::omp_parallel_placed_region;
 using policy::omp::omp_launch_t;
 
 ///
@@ -389,6 +592,8 @@ using policy::omp::omp_launch_t;
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+///
+using policy::omp::omp_reduce_reproducible;
 
 ///
 /// Type aliases for omp reductions
@@ -397,6 +602,8 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+///
+using policy::omp::unordered_omp_region_iter_balanced;
 
 }  // namespace RAJA
 
@@ -25,13 +25,20 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/ExactAccumulator.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
@@ -42,31 +49,267 @@ namespace RAJA
 
 namespace detail
 {
+
+/*!
+ * \brief One padded slot per OpenMP thread, owned by a root reducer.
+ *
+ *        The slots are allocated by the first thread of a parallel region
+ *        that asks for one, so reducers only used outside parallel regions
+ *        never allocate.
+ */
+template <typename T>
+class ReduceOMPSlots
+{
+  using slots_type = PaddedThreadSlots<T>;
+
+  T init;
+  int num_threads = 0;
+  mutable std::atomic<slots_type *> slots{nullptr};
+
+public:
+  ReduceOMPSlots() = default;
+
+  explicit ReduceOMPSlots(T const &init_)
+      : init(init_), num_threads(omp_get_max_threads())
+  {
+  }
+
+  ReduceOMPSlots(ReduceOMPSlots const &) = delete;
+  ReduceOMPSlots &operator=(ReduceOMPSlots const &) = delete;
+
+  ~ReduceOMPSlots() { delete slots.load(std::memory_order_relaxed); }
+
+  int size() const
+  {
+    slots_type *ptr = slots.load(std::memory_order_acquire);
+    return ptr ? ptr->size() : 0;
+  }
+
+  T &operator[](int i) const
+  {
+    return (*slots.load(std::memory_order_acquire))[i];
+  }
+
+  //! set every slot, and the slots allocated later, to val
+  void fill(T const &val)
+  {
+    init = val;
+    if (slots_type *ptr = slots.load(std::memory_order_acquire)) {
+      ptr->fill(val);
+    }
+  }
+
+  /*!
+   * \return the slot of the calling thread, or nullptr if the thread is not
+   *         in exactly one parallel region. Outside parallel regions every
+   *         thread, including threads not started by OpenMP, has id 0, and
+   *         in nested regions ids repeat across teams, so those threads
+   *         share no slot. Also nullptr if the id is beyond the slots.
+   */
+  T *thread_slot() const
+  {
+    if (omp_get_level() != 1) {
+      return nullptr;
+    }
+    slots_type *ptr = slots.load(std::memory_order_acquire);
+    if (ptr == nullptr) {
+      slots_type *fresh = new slots_type(
+          std::max(num_threads, omp_get_num_threads()), init);
+      if (slots.compare_exchange_strong(ptr,
+                                        fresh,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire)) {
+        ptr = fresh;
+      } else {
+        delete fresh;
+      }
+    }
+    return ptr->slot(omp_get_thread_num());
+  }
+};
+
+/*!
+ * \brief Combiner for omp_reduce reducers.
+ *
+ *        The reducer object owned by the user (the root) holds one padded
+ *        slot per OpenMP thread. Thread-private copies fold their value into
+ *        the slot of the thread that destroys them, so no lock is taken in
+ *        the common case. The slots are combined into the root value in a
+ *        single pass when the result is requested.
+ *
+ *        Copies destroyed outside a parallel region, in a nested parallel
+ *        region, or by a thread whose id exceeds the number of slots fall
+ *        back to combining directly into the root inside a critical
+ *        section.
+ */
 template <typename T, typename Reduce>
 class ReduceOMP
     : public reduce::detail::BaseCombinable<T, Reduce, ReduceOMP<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMP>;
 
+  ReduceOMPSlots<T> slots;
+
 public:
-  using Base::Base;
   //! prohibit compiler-generated default ctor
   ReduceOMP() = delete;
 
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMP(T init_val, T identity_ = T())
+      : Base(init_val, identity_), slots(identity_)
+  {
+  }
+
+  //! copies are thread-private and combine through the root's slots
+  ReduceOMP(ReduceOMP const &other) : Base(other) {}
+
   ~ReduceOMP()
   {
     if (Base::parent) {
-#pragma omp critical(ompReduceCritical)
-      Reduce()(Base::parent->local(), Base::my_data);
+      root().combine_partial(Base::my_data);
       Base::my_data = Base::identity;
     }
   }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots.fill(identity_);
+  }
+
+  T get_combined() const
+  {
+    if (!Base::parent) {
+      for (int i = 0; i < slots.size(); ++i) {
+        Reduce{}(Base::my_data, slots[i]);
+        slots[i] = Base::identity;
+      }
+    }
+    return Base::my_data;
+  }
+
+private:
+  ReduceOMP const &root() const
+  {
+    return *static_cast<ReduceOMP const *>(Base::parent);
+  }
+
+  void combine_partial(T const &val) const
+  {
+    if (T *slot = slots.thread_slot()) {
+      Reduce{}(*slot, val);
+    } else {
+#pragma omp critical(ompReduceCritical)
+      Reduce{}(Base::my_data, val);
+    }
+  }
+};
+
+/*!
+ * \brief Combiner for floating-point sums with omp_reduce_reproducible.
+ *
+ *        Each copy accumulates into an ExactAccumulator, so the result is
+ *        bitwise identical for any thread count, schedule, or loop
+ *        execution policy. Partial accumulators are merged through
+ *        per-thread slots in the same way as ReduceOMP.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPExactSum
+{
+  using accumulator_type = ExactAccumulator<T>;
+
+  ReduceOMPExactSum const *parent = nullptr;
+  T identity;
+  accumulator_type mutable my_data;
+  ReduceOMPSlots<accumulator_type> slots;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPExactSum() = delete;
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPExactSum(T init_val, T identity_ = T())
+      : identity{identity_}, slots(accumulator_type{})
+  {
+    my_data.add(init_val);
+  }
+
+  //! copies are thread-private and combine through the root's slots
+  ReduceOMPExactSum(ReduceOMPExactSum const &other)
+      : parent{other.parent ? other.parent : &other}, identity{other.identity}
+  {
+  }
+
+  ~ReduceOMPExactSum()
+  {
+    if (parent) {
+      parent->combine_partial(my_data);
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    identity = identity_;
+    my_data.clear();
+    my_data.add(init_val);
+    slots.fill(accumulator_type{});
+  }
+
+  void combine(T const &other) const { my_data.add(other); }
+
+  T get() const { return get_combined(); }
+
+  T get_combined() const
+  {
+    if (!parent) {
+      for (int i = 0; i < slots.size(); ++i) {
+        my_data.add(slots[i]);
+        slots[i].clear();
+      }
+    }
+    return my_data.get();
+  }
+
+private:
+  void combine_partial(accumulator_type const &val) const
+  {
+    if (accumulator_type *slot = slots.thread_slot()) {
+      slot->add(val);
+    } else {
+#pragma omp critical(ompReduceCritical)
+      my_data.add(val);
+    }
+  }
+};
+
+/*!
+ * \brief Combiner for omp_reduce_reproducible reducers.
+ *
+ *        Floating-point sums use ReduceOMPExactSum; every other reduction
+ *        is already independent of combining order and uses ReduceOMP.
+ */
+template <typename T, typename Reduce>
+using ReduceOMPReproducibleBase = typename std::conditional<
+    std::is_floating_point<T>::value &&
+        std::is_same<Reduce, RAJA::reduce::sum<T>>::value,
+    ReduceOMPExactSum<T, Reduce>,
+    ReduceOMP<T, Reduce>>::type;
+
+template <typename T, typename Reduce>
+class ReduceOMPReproducible : public ReduceOMPReproducibleBase<T, Reduce>
+{
+  using Base = ReduceOMPReproducibleBase<T, Reduce>;
+
+public:
+  using Base::Base;
 };
 
 }  // namespace detail
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_reproducible, detail::ReduceOMPReproducible)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Old ordered reductions are included below.
@@ -8,6 +8,9 @@
 #ifndef RAJA_region_openmp_HPP
 #define RAJA_region_openmp_HPP
 
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/plugins.hpp"
+
 namespace RAJA
 {
 namespace policy
@@ -37,15 +40,71 @@ namespace omp
 template <typename Func>
 RAJA_INLINE void region_impl(const omp_parallel_region &, Func &&body)
 {
+  const util::PluginContext* plugin_context = util::current_plugin_context();
 
 #pragma omp parallel
     { // curly brackets to ensure body() is encapsulated in omp parallel region
+      util::PluginThreadScope plugin_scope(plugin_context);
+
       //thread private copy of body
       auto loopbody = body;
       loopbody();
+
+      // do not leave blocks cached by threads that may now sit idle
+      RAJA::basic_mempool::flush_thread_caches();
     }
 }
 
+/*!
+ * \brief RAJA::region implementation for OpenMP with thread placement.
+ *
+ * Generates an OpenMP parallel region with the proc_bind and num_threads
+ * clauses of the policy. With OMP_PLACES set, the threads of regions with
+ * the same clauses run in the same places, so each thread finds the data
+ * it touched in earlier regions in its own cache and NUMA domain.
+ *
+ */
+template <omp_proc_bind Bind, int NumThreads, typename Func>
+RAJA_INLINE void region_impl(const omp_parallel_placed_region<Bind, NumThreads> &,
+                             Func &&body)
+{
+  const int num_threads = NumThreads > 0 ? NumThreads : omp_get_max_threads();
+  const util::PluginContext* plugin_context = util::current_plugin_context();
+
+  auto run = [&]() {
+    util::PluginThreadScope plugin_scope(plugin_context);
+
+    //thread private copy of body
+    auto loopbody = body;
+    loopbody();
+
+    // do not leave blocks cached by threads that may now sit idle
+    RAJA::basic_mempool::flush_thread_caches();
+  };
+
+#if !defined(RAJA_COMPILER_MSVC)
+  if (Bind == omp_proc_bind::close) {
+#pragma omp parallel num_threads(num_threads) proc_bind(close)
+    {
+      run();
+    }
+    return;
+  }
+  if (Bind == omp_proc_bind::spread) {
+#pragma omp parallel num_threads(num_threads) proc_bind(spread)
+    {
+      run();
+    }
+    return;
+  }
+#endif
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    run();
+  }
+}
+
 }  // namespace omp
 
 }  // namespace policy
@@ -39,47 +39,104 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+namespace openmp
+{
+
 /*!
-        \brief explicit inclusive inplace scan given range, function, and
-   initial value
+        \brief scan [begin, end) into out in a single parallel region
+
+        Each thread reduces a contiguous block of the input, then, after one
+        barrier, folds the sums of the blocks before it into its own carry
+        and scans its block from the input straight into the output. The
+        input is read twice and the output written once, and no thread waits
+        on a serial carry pass. in and out may alias.
+        If Exclusive, out[0] = v, otherwise v is unused.
 */
-template <typename Policy, typename Iter, typename BinFn>
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename Value>
 RAJA_INLINE
-concepts::enable_if_t<resources::EventProxy<resources::Host>,
-                      type_traits::is_openmp_policy<Policy>>
-inclusive_inplace(
-    resources::Host host_res,
-    const Policy&,
-    Iter begin,
-    Iter end,
-    BinFn f)
+void scan(Iter begin, Iter end, OutIter out, BinFn f, Value const& v)
 {
   using std::distance;
   using RAJA::detail::firstIndex;
-  using Value = typename ::std::iterator_traits<Iter>::value_type;
   const auto n = distance(begin, end);
   using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return;
+  }
   const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, Value());
+  ::std::vector<Value> sums(p0, v);
 #pragma omp parallel num_threads(p0)
   {
+    // p <= n, so every thread's block is nonempty
     const int p = omp_get_num_threads();
     const int pid = omp_get_thread_num();
     const DistanceT idx_begin = firstIndex(n, p, pid);
     const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::seq_exec{},
-                        begin + idx_begin, begin + idx_end, f);
-      sums[pid] = begin[idx_end - 1];
+
+    if (pid < p - 1) {
+      Value agg = begin[idx_begin];
+      for (DistanceT i = idx_begin + 1; i < idx_end; ++i) {
+        agg = f(agg, begin[i]);
+      }
+      sums[pid] = agg;
     }
 #pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, ::RAJA::seq_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
+    if (Exclusive) {
+      Value agg = v;
+      for (int k = 0; k < pid; ++k) {
+        agg = f(agg, sums[k]);
+      }
+      for (DistanceT i = idx_begin; i < idx_end; ++i) {
+        Value t = begin[i];
+        out[i] = agg;
+        agg = f(agg, t);
+      }
+    } else {
+      Value agg = begin[idx_begin];
+      if (pid > 0) {
+        Value carry = sums[0];
+        for (int k = 1; k < pid; ++k) {
+          carry = f(carry, sums[k]);
+        }
+        agg = f(carry, agg);
+      }
+      out[idx_begin] = agg;
+      for (DistanceT i = idx_begin + 1; i < idx_end; ++i) {
+        agg = f(agg, begin[i]);
+        out[i] = agg;
+      }
     }
   }
+}
+
+}  // namespace openmp
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  if (begin != end) {
+    detail::openmp::scan<false>(begin, end, begin, f, Value(*begin));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -100,34 +157,8 @@ exclusive_inplace(
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  using RAJA::detail::firstIndex;
   using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const auto n = distance(begin, end);
-  using DistanceT = typename std::remove_const<decltype(n)>::type;
-  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
-#pragma omp barrier
-    if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, seq_exec{},
-                        begin + idx_begin, begin + idx_end, f, init);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, seq_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  detail::openmp::scan<true>(begin, end, begin, f, Value(v));
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -142,15 +173,18 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 inclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+  using Value = typename std::remove_reference<decltype(*out)>::type;
+  if (begin != end) {
+    detail::openmp::scan<false>(begin, end, out, f, Value(*begin));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
@@ -167,16 +201,17 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 exclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+  using Value = typename std::remove_reference<decltype(*out)>::type;
+  detail::openmp::scan<true>(begin, end, out, f, Value(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 }  // namespace scan
@@ -21,8 +21,12 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
 
 #include <omp.h>
 
@@ -30,6 +34,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -88,47 +94,120 @@ inline void sort_task(Sorter sorter,
 
 #else
 
+/*!
+        \brief merge pairs of sorted thread blocks from src into dst
+
+        Blocks [pair_begin, pair_begin + width) and
+        [pair_begin + width, pair_begin + 2*width) are merged into dst. Every
+        thread produces the part of the merged output that lines up with its
+        own block, using a merge path search to find where its inputs start
+        and end, so all threads work at every level. Must be called by all
+        threads of the parallel region.
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+inline void merge_level(SrcIter src,
+                        DstIter dst,
+                        RAJA::detail::IterDiff<SrcIter> n,
+                        int num_threads,
+                        int thread_id,
+                        int width,
+                        Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const auto split = RAJA::detail::merge_block_split(
+      src, n, diff_type(num_threads), diff_type(thread_id), diff_type(width),
+      comp);
+
+  // merging moves out of src, so every thread must finish its search first
+#pragma omp barrier
+
+  RAJA::detail::merge_block_move(src, dst, split, comp);
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by manually assigning work to threads
+
+        Each thread sorts one block, then the blocks are merged pairwise,
+        alternating between the range and buf. buf has room for n objects
+        and is nullptr if it could not be allocated, in which case the
+        blocks are merged in place by one thread per pair.
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
+                                 RAJA::detail::IterVal<Iter>* buf,
                                  Compare comp)
 {
   using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
-  const diff_type num_threads = omp_get_num_threads();
+  const int num_threads = omp_get_num_threads();
 
-  const diff_type thread_id = omp_get_thread_num();
+  const int thread_id = omp_get_thread_num();
 
   const diff_type i_begin = firstIndex(n, num_threads, thread_id);
-  {
-    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+  const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+
+  // this thread sorts range [i_begin, i_end)
+  sorter(begin + i_begin, begin + i_end, comp);
 
-    // this thread sorts range [i_begin, i_end)
-    sorter(begin + i_begin, begin + i_end, comp);
+  if (num_threads == 1) {
+    return;
   }
 
-  // hierarchically merge ranges
-  for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
+  if (buf == nullptr) {
+
+    // hierarchically merge ranges
+    for (int middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
 
-    diff_type end_offset = 2*middle_offset;
+      const int end_offset = 2*middle_offset;
 
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+      const diff_type i_middle  = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
+      const diff_type i_pair_end = firstIndex(n, num_threads, std::min(thread_id + end_offset,   num_threads));
 
 #pragma omp barrier
 
-    if (thread_id % end_offset == 0) {
+      if (thread_id % end_offset == 0) {
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+        // this thread merges ranges [i_begin, i_middle) and [i_middle, i_pair_end)
+        RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_pair_end, comp);
+      }
     }
+
+    return;
+  }
+
+  // move this thread's sorted block into the buffer
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    new(&buf[i]) value_type(std::move(begin[i]));
+  }
+
+  bool in_buf = true;
+  for (int width = 1; width < num_threads; width *= 2) {
+
+#pragma omp barrier
+
+    if (in_buf) {
+      merge_level(buf, begin, n, num_threads, thread_id, width, comp);
+    } else {
+      merge_level(begin, buf, n, num_threads, thread_id, width, comp);
+    }
+    in_buf = !in_buf;
+  }
+
+  // other threads may still be reading this thread's part of the last source
+#pragma omp barrier
+
+  if (in_buf) {
+    std::move(buf + i_begin, buf + i_end, begin + i_begin);
+  }
+
+  for (diff_type i = i_begin; i < i_end; ++i) {
+    buf[i].~value_type();
   }
 }
 
@@ -177,15 +256,389 @@ void sort(Sorter sorter,
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
     RAJA_UNUSED_VAR(requested_num_threads); // avoid warning in hip device code
 
+    // merge buffer, objects are constructed and destroyed in it by the
+    // parallel region, so it is only freed here
+    using value_type = RAJA::detail::IterVal<Iter>;
+    host_scratch_ptr<value_type> buf =
+        allocate_host_scratch<value_type>(n);
+    value_type* buf_ptr = buf.get();
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+      sort_parallel_region(sorter, begin, n, buf_ptr, comp);
     }
 
 #endif
   }
 }
 
+// this number is arbitrary
+constexpr int get_min_radix_iterates_per_thread() { return 4096; }
+
+/*!
+        \brief turn per thread radix sort counts into the offsets where each
+               thread starts writing each bucket, and return true if a
+               single bucket holds all n keys
+
+        counts holds radix_sort_num_buckets() entries per thread, ordered by
+        thread, offsets are ordered by bucket and then by thread so the
+        scatter is stable.
+*/
+template <typename Count>
+inline bool radix_sort_thread_offsets(Count* counts,
+                                      int num_threads,
+                                      Count n)
+{
+  constexpr int num_buckets = RAJA::detail::radix_sort_num_buckets();
+
+  Count offset = 0;
+  bool one_bucket = false;
+  for (int b = 0; b < num_buckets; ++b) {
+    const Count bucket_begin = offset;
+    for (int t = 0; t < num_threads; ++t) {
+      const Count count = counts[t*num_buckets + b];
+      counts[t*num_buckets + b] = offset;
+      offset += count;
+    }
+    one_bucket = one_bucket || (offset - bucket_begin == n);
+  }
+  return one_bucket;
+}
+
+/*!
+        \brief scatter the block [i_begin, i_end) of keys, see
+               radix_sort_scatter
+*/
+template <bool Construct,
+          typename Compare,
+          typename KeyIn,
+          typename KeyOut,
+          typename Count>
+inline void radix_sort_scatter_block(KeyIn keys,
+                                     std::nullptr_t,
+                                     Count i_begin,
+                                     Count i_end,
+                                     KeyOut keys_out,
+                                     std::nullptr_t,
+                                     int shift,
+                                     Count* offsets)
+{
+  RAJA::detail::radix_sort_scatter<Compare>(
+      keys + i_begin, i_end - i_begin, keys_out, shift, offsets);
+}
+///
+template <bool Construct,
+          typename Compare,
+          typename KeyIn,
+          typename ValIn,
+          typename KeyOut,
+          typename ValOut,
+          typename Count>
+inline void radix_sort_scatter_block(KeyIn keys,
+                                     ValIn vals,
+                                     Count i_begin,
+                                     Count i_end,
+                                     KeyOut keys_out,
+                                     ValOut vals_out,
+                                     int shift,
+                                     Count* offsets)
+{
+  RAJA::detail::radix_sort_scatter_pairs<Construct, Compare>(
+      keys + i_begin, vals + i_begin, i_end - i_begin,
+      keys_out, vals_out, shift, offsets);
+}
+
+/*!
+        \brief copy one thread's block of keys back from the buffer
+*/
+template <typename KeyIter, typename KeyTmp, typename Count>
+inline void radix_sort_copy_back_block(KeyIter keys,
+                                       std::nullptr_t,
+                                       KeyTmp keys_tmp,
+                                       std::nullptr_t,
+                                       Count i_begin,
+                                       Count i_end)
+{
+  std::copy(keys_tmp + i_begin, keys_tmp + i_end, keys + i_begin);
+}
+///
+template <typename KeyIter, typename ValIter, typename KeyTmp, typename ValTmp, typename Count>
+inline void radix_sort_copy_back_block(KeyIter keys,
+                                       ValIter vals,
+                                       KeyTmp keys_tmp,
+                                       ValTmp vals_tmp,
+                                       Count i_begin,
+                                       Count i_end)
+{
+  std::copy(keys_tmp + i_begin, keys_tmp + i_end, keys + i_begin);
+  std::move(vals_tmp + i_begin, vals_tmp + i_end, vals + i_begin);
+}
+
+/*!
+        \brief radix sort keys, and vals unless it is nullptr, with every
+               thread of the parallel region owning one block of the range
+
+        Each pass every thread counts the digits in its block, one thread
+        turns the counts into offsets, and every thread scatters its block
+        into the other buffer. Passes where all keys share a digit are
+        skipped. counts has room for radix_sort_num_buckets() entries per
+        thread. vals_constructed is set if values were move constructed
+        into vals_tmp.
+*/
+template <typename Compare,
+          typename KeyIter,
+          typename ValIter,
+          typename KeyTmp,
+          typename ValTmp>
+inline void radix_sort_parallel_region(KeyIter keys,
+                                       ValIter vals,
+                                       RAJA::detail::IterDiff<KeyIter> n,
+                                       KeyTmp keys_tmp,
+                                       ValTmp vals_tmp,
+                                       RAJA::detail::IterDiff<KeyIter>* counts,
+                                       bool& skip,
+                                       bool& vals_constructed)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+
+  constexpr int num_buckets = RAJA::detail::radix_sort_num_buckets();
+
+  const int num_threads = omp_get_num_threads();
+
+  const int thread_id = omp_get_thread_num();
+
+  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+
+  diff_type* my_counts = counts + thread_id*num_buckets;
+
+  bool in_buf = false;
+  bool constructed = false;
+  for (int shift = 0; shift < RAJA::detail::radix_sort_key<key_type, Compare>::num_bits;
+       shift += RAJA::detail::radix_sort_digit_bits()) {
+
+    std::fill(my_counts, my_counts + num_buckets, diff_type(0));
+    if (in_buf) {
+      RAJA::detail::radix_sort_count<Compare>(keys_tmp + i_begin, keys_tmp + i_end, shift, my_counts);
+    } else {
+      RAJA::detail::radix_sort_count<Compare>(keys + i_begin, keys + i_end, shift, my_counts);
+    }
+
+#pragma omp barrier
+
+#pragma omp single
+    {
+      skip = radix_sort_thread_offsets(counts, num_threads, n);
+    }
+
+    if (!skip) {
+      if (in_buf) {
+        radix_sort_scatter_block<false, Compare>(
+            keys_tmp, vals_tmp, i_begin, i_end, keys, vals, shift, my_counts);
+      } else if (!constructed) {
+        radix_sort_scatter_block<true, Compare>(
+            keys, vals, i_begin, i_end, keys_tmp, vals_tmp, shift, my_counts);
+        constructed = true;
+      } else {
+        radix_sort_scatter_block<false, Compare>(
+            keys, vals, i_begin, i_end, keys_tmp, vals_tmp, shift, my_counts);
+      }
+      in_buf = !in_buf;
+    }
+
+#pragma omp barrier
+  }
+
+  if (in_buf) {
+    radix_sort_copy_back_block(keys, vals, keys_tmp, vals_tmp, i_begin, i_end);
+  }
+
+  if (thread_id == 0) {
+    vals_constructed = constructed;
+  }
+}
+
+/*!
+        \brief number of threads to use for radix sorting n keys
+*/
+template <typename diff_type>
+inline diff_type radix_sort_num_threads(diff_type n)
+{
+  constexpr diff_type min_iterates_per_thread = get_min_radix_iterates_per_thread();
+
+  const diff_type max_threads = omp_get_max_threads();
+
+  return std::min((n+min_iterates_per_thread-1)/min_iterates_per_thread, max_threads);
+}
+
+/*!
+        \brief radix sort given range of arithmetic keys in parallel
+
+        \return false without modifying the range if it is too short for
+        radix sort or scratch memory could not be allocated
+*/
+template <typename KeyIter, typename Compare>
+inline bool radix_sort(KeyIter keys_begin,
+                       KeyIter keys_end,
+                       Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+
+  const diff_type n = keys_end - keys_begin;
+
+  const diff_type requested_num_threads = radix_sort_num_threads(n);
+
+  if (requested_num_threads <= 1) {
+    return RAJA::detail::radix_sort(keys_begin, keys_end, comp);
+  }
+
+  host_scratch_ptr<key_type> keys_buf =
+      allocate_host_scratch<key_type>(n);
+  if (keys_buf == nullptr) {
+    return false;
+  }
+
+  std::vector<diff_type> counts(requested_num_threads * RAJA::detail::radix_sort_num_buckets());
+  diff_type* counts_ptr = counts.data();
+  key_type* keys_tmp = keys_buf.get();
+  bool skip = false;
+  bool vals_constructed = false;
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    radix_sort_parallel_region<Compare>(keys_begin, nullptr, n,
+                                        keys_tmp, nullptr, counts_ptr,
+                                        skip, vals_constructed);
+  }
+
+  return true;
+}
+
+/*!
+        \brief radix sort given range of pairs by arithmetic keys in parallel
+
+        \return false without modifying the range if it is too short for
+        radix sort or scratch memory could not be allocated
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+inline bool radix_sort_pairs(KeyIter keys_begin,
+                             KeyIter keys_end,
+                             ValIter vals_begin,
+                             Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using val_type = RAJA::detail::IterVal<ValIter>;
+
+  const diff_type n = keys_end - keys_begin;
+
+  const diff_type requested_num_threads = radix_sort_num_threads(n);
+
+  if (requested_num_threads <= 1) {
+    return RAJA::detail::radix_sort_pairs(keys_begin, keys_end, vals_begin, comp);
+  }
+
+  host_scratch_ptr<key_type> keys_buf =
+      allocate_host_scratch<key_type>(n);
+  if (keys_buf == nullptr) {
+    return false;
+  }
+
+  host_scratch_ptr<val_type> vals_buf =
+      allocate_host_scratch<val_type>(n);
+  if (vals_buf == nullptr) {
+    return false;
+  }
+
+  // Manage the lifetime of the objects constructed in the buffer
+  using buf_destroyer_type = DestroyType<val_type, diff_type>;
+  buf_destroyer_type buf_destroyer;
+
+  std::unique_ptr<val_type, buf_destroyer_type&> vals_objs(
+      vals_buf.get(), buf_destroyer);
+
+  std::vector<diff_type> counts(requested_num_threads * RAJA::detail::radix_sort_num_buckets());
+  diff_type* counts_ptr = counts.data();
+  key_type* keys_tmp = keys_buf.get();
+  val_type* vals_tmp = vals_buf.get();
+  bool skip = false;
+  bool vals_constructed = false;
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    radix_sort_parallel_region<Compare>(keys_begin, vals_begin, n,
+                                        keys_tmp, vals_tmp, counts_ptr,
+                                        skip, vals_constructed);
+  }
+
+  if (vals_constructed) {
+    buf_destroyer.size = n;
+  }
+
+  return true;
+}
+
+/*!
+        \brief sort given range using radix sort if the keys and comparison
+               function allow it, otherwise using sorter
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<RAJA::detail::is_radix_sortable<Iter, Compare>>
+sort_keys(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  if (!openmp::radix_sort(begin, end, comp)) {
+    openmp::sort(sorter, begin, end, comp);
+  }
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+sort_keys(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  openmp::sort(sorter, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs using radix sort if the keys and
+               comparison function allow it, otherwise using sorter
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<RAJA::detail::is_radix_sortable<KeyIter, Compare>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  if (!openmp::radix_sort_pairs(keys_begin, keys_end, vals_begin, comp)) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    openmp::sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<KeyIter, Compare>>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  openmp::sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -203,7 +656,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  detail::openmp::sort_keys(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -221,7 +674,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::sort_keys(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -240,10 +693,7 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -262,10 +712,7 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -0,0 +1,163 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the static loop partition used by the
+ *          OpenMP static schedule policies.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_static_partition_openmp_HPP
+#define RAJA_static_partition_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+namespace internal
+{
+
+/*!
+ * \brief Iterations [begin, end) of thread tid of a team of num_threads
+ *        in a static schedule without a chunk size: one contiguous block
+ *        per thread, the first len % num_threads blocks one longer.
+ *
+ *        This is the partition OpenMP runtimes commonly use for
+ *        schedule(static), but OpenMP only promises the same partition for
+ *        loops in the same parallel region. Computing it here makes it the
+ *        same for every loop of the same length and team size.
+ */
+template <typename T>
+RAJA_INLINE void static_block(T len, int tid, int num_threads, T& begin, T& end)
+{
+  const T t = static_cast<T>(tid);
+  const T q = len / static_cast<T>(num_threads);
+  const T r = len % static_cast<T>(num_threads);
+  begin = t * q + (t < r ? t : r);
+  end = begin + q + (t < r ? 1 : 0);
+}
+
+/*!
+ * \brief The blocks of iterations of [0, len) of thread tid of a team of
+ *        num_threads in a static schedule: blocks of ChunkSize dealt round
+ *        robin to the threads for a positive ChunkSize, one block per
+ *        thread otherwise. Block boundaries other than len are multiples of
+ *        Align; a ChunkSize that is not is rounded up, like the OpenMP
+ *        schedule(simd:static) modifier.
+ *
+ *        The blocks start at first, first + stride, ... below len and are
+ *        chunk iterations long, the last one cut at len. Callers loop over
+ *        them directly when the loop body needs clauses on variables of the
+ *        enclosing parallel region.
+ */
+template <int ChunkSize, int Align, typename T>
+RAJA_INLINE void static_blocks(T len,
+                               int tid,
+                               int num_threads,
+                               T& first,
+                               T& chunk,
+                               T& stride)
+{
+  static_assert(Align > 0, "Align must be positive");
+  const T align = static_cast<T>(Align);
+  if (ChunkSize > 0) {
+    chunk = (static_cast<T>(ChunkSize) + align - 1) / align * align;
+    stride = chunk * static_cast<T>(num_threads);
+    first = chunk * static_cast<T>(tid);
+  } else {
+    T b;
+    T e;
+    static_block((len + align - 1) / align, tid, num_threads, b, e);
+    first = b * align;
+    chunk = e * align - first;
+    // one block, the next start is past len
+    stride = len;
+  }
+}
+
+/*!
+ * \brief Call block(begin, end) for each non empty block of iterations of
+ *        [0, len) of the calling thread, see static_blocks. Like 'omp for
+ *        schedule(static) nowait', it must be reached by all threads of the
+ *        team.
+ */
+template <int ChunkSize, int Align, typename T, typename Func>
+RAJA_INLINE void static_for_blocks(T len, Func&& block)
+{
+  T first;
+  T chunk;
+  T stride;
+  static_blocks<ChunkSize, Align>(len, omp_get_thread_num(),
+                                  omp_get_num_threads(), first, chunk, stride);
+  for (T b = first; b < len; b += stride) {
+    const T e = (len - b > chunk) ? b + chunk : len;
+    if (b < e) {
+      block(b, e);
+    }
+  }
+}
+
+/*!
+ * \brief Call body(i) for the iterations of [0, len) of the calling thread
+ *        in a static schedule, see static_for_blocks.
+ */
+template <int ChunkSize, typename T, typename Func>
+RAJA_INLINE void static_for(T len, Func&& body)
+{
+  static_for_blocks<ChunkSize, 1>(len, [&](T b, T e) {
+    for (T i = b; i < e; ++i) {
+      body(i);
+    }
+  });
+}
+
+/*!
+ * \brief Like static_for, with blocks aligned to SimdLen iterations and
+ *        each block run as an 'omp simd simdlen(SimdLen)' loop. With data
+ *        aligned to SimdLen elements at iteration 0, every block starts
+ *        on aligned data.
+ */
+template <int ChunkSize, int SimdLen, typename T, typename Func>
+RAJA_INLINE void static_simd_for(T len, Func&& body)
+{
+  static_for_blocks<ChunkSize, SimdLen>(len, [&](T b, T e) {
+#if defined(RAJA_COMPILER_MSVC)
+    for (T i = b; i < e; ++i) {
+      body(i);
+    }
+#else
+    #pragma omp simd simdlen(SimdLen)
+    for (T i = b; i < e; ++i) {
+      body(i);
+    }
+#endif
+  });
+}
+
+}  // namespace internal
+}  // namespace omp
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
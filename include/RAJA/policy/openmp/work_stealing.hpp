@@ -0,0 +1,200 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the work-stealing loop scheduler used by
+ *          the OpenMP omp_work_stealing_exec policy.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_work_stealing_openmp_HPP
+#define RAJA_work_stealing_openmp_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+#include <new>
+
+#include <omp.h>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/mutex.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+namespace internal
+{
+
+/*!
+ * \brief Block of loop iterations owned by one thread of a work-stealing
+ *        loop. The owner takes chunks from the front of the block and
+ *        thieves take the back half.
+ */
+struct alignas(RAJA::DATA_ALIGN) WorkStealingRange {
+  RAJA::omp::mutex mtx;
+  Index_type begin = 0;
+  Index_type end = 0;
+};
+
+/*!
+ * \brief Per-thread iteration blocks for one work-stealing loop.
+ *
+ *        The iteration space is split statically across
+ *        omp_get_max_threads() blocks when constructed. Each thread of
+ *        the enclosing parallel region then calls run(), which executes
+ *        chunks of its own block and steals from other blocks until it
+ *        finds no work left. Blocks only ever shrink, except when a thief
+ *        installs stolen work in its own block, so a thread that finds
+ *        every block empty may exit without leaving iterations unexecuted.
+ */
+class WorkStealingRanges
+{
+public:
+  WorkStealingRanges(Index_type len, int chunk_size)
+      : num_ranges(omp_get_max_threads()),
+        chunk(chunk_size > 0
+                  ? chunk_size
+                  : std::max<Index_type>(1, len / (32 * num_ranges)))
+  {
+    ranges = RAJA::allocate_aligned_type<WorkStealingRange>(
+        RAJA::DATA_ALIGN, num_ranges * sizeof(WorkStealingRange));
+    if (ranges == nullptr) {
+      RAJA_ABORT_OR_THROW("WorkStealingRanges failed to allocate");
+    }
+    for (int t = 0; t < num_ranges; ++t) {
+      WorkStealingRange* r = new (&ranges[t]) WorkStealingRange{};
+      r->begin = (len * t) / num_ranges;
+      r->end = (len * (t + 1)) / num_ranges;
+    }
+  }
+
+  WorkStealingRanges(const WorkStealingRanges&) = delete;
+  WorkStealingRanges& operator=(const WorkStealingRanges&) = delete;
+
+  ~WorkStealingRanges()
+  {
+    for (int t = 0; t < num_ranges; ++t) {
+      ranges[t].~WorkStealingRange();
+    }
+    RAJA::free_aligned(ranges);
+  }
+
+  /*!
+   * \brief Execute range_body(begin, end) on chunks of iterations until
+   *        no work is left. Must be called by every thread of the
+   *        enclosing parallel region.
+   */
+  template <typename RangeBody>
+  RAJA_INLINE void run(RangeBody&& range_body)
+  {
+    const int tid = omp_get_thread_num();
+    unsigned seed = 2654435761u * static_cast<unsigned>(tid + 1);
+
+    if (tid >= num_ranges) {
+      // thread was not given a block; it can only steal
+      while (steal_into(nullptr, tid, seed, range_body)) {
+      }
+      return;
+    }
+
+    WorkStealingRange& mine = ranges[tid];
+    for (;;) {
+      Index_type b, e;
+      {
+        RAJA::lock_guard<RAJA::omp::mutex> lock(mine.mtx);
+        b = mine.begin;
+        e = std::min(b + chunk, mine.end);
+        mine.begin = e;
+      }
+      if (b < e) {
+        range_body(b, e);
+      } else if (!steal_into(&mine, tid, seed, range_body)) {
+        return;
+      }
+    }
+  }
+
+private:
+  WorkStealingRange* ranges = nullptr;
+  int num_ranges;
+  Index_type chunk;
+
+  /*!
+   * \brief Steal the back half of another thread's block, visiting victims
+   *        in a random rotation. Stolen work is installed in mine so that
+   *        other threads can steal from it in turn; a thread without a
+   *        block executes it directly.
+   *
+   * \return false if every other block was found empty
+   */
+  template <typename RangeBody>
+  bool steal_into(WorkStealingRange* mine,
+                  int tid,
+                  unsigned& seed,
+                  RangeBody&& range_body)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    const int start = static_cast<int>(seed % num_ranges);
+
+    for (int k = 0; k < num_ranges; ++k) {
+      const int v = (start + k) % num_ranges;
+      if (v == tid) {
+        continue;
+      }
+
+      Index_type b, e;
+      {
+        WorkStealingRange& victim = ranges[v];
+        RAJA::lock_guard<RAJA::omp::mutex> lock(victim.mtx);
+        const Index_type remaining = victim.end - victim.begin;
+        if (remaining <= 0) {
+          continue;
+        }
+        const Index_type take =
+            remaining > chunk ? (remaining + 1) / 2 : remaining;
+        e = victim.end;
+        b = e - take;
+        victim.end = b;
+      }
+
+      if (mine) {
+        RAJA::lock_guard<RAJA::omp::mutex> lock(mine->mtx);
+        mine->begin = b;
+        mine->end = e;
+      } else {
+        range_body(b, e);
+      }
+      return true;
+    }
+    return false;
+  }
+};
+
+}  // namespace internal
+}  // namespace omp
+}  // namespace policy
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
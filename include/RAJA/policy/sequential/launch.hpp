@@ -21,6 +21,7 @@
 #include "RAJA/pattern/launch/launch_core.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 #include "RAJA/pattern/params/forall.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 namespace RAJA
 {
@@ -49,12 +50,11 @@ struct LaunchExecute<RAJA::seq_launch_t> {
 
     LaunchContext ctx;
 
-    char *kernel_local_mem = new char[params.shared_mem_size];
-    ctx.shared_mem_ptr = kernel_local_mem;
+    ThreadScratch shared_mem(params.shared_mem_size);
+    ctx.shared_mem_ptr = shared_mem.get();
 
     body(ctx);
 
-    delete[] kernel_local_mem;
     ctx.shared_mem_ptr = nullptr;
 
     return resources::EventProxy<resources::Resource>(res);
@@ -70,12 +70,11 @@ struct LaunchExecute<RAJA::seq_launch_t> {
     expt::ParamMultiplexer::init<seq_exec>(launch_reducers);
 
     LaunchContext ctx;
-    char *kernel_local_mem = new char[launch_params.shared_mem_size];
-    ctx.shared_mem_ptr = kernel_local_mem;
+    ThreadScratch shared_mem(launch_params.shared_mem_size);
+    ctx.shared_mem_ptr = shared_mem.get();
 
     expt::invoke_body(launch_reducers, body, ctx);
 
-    delete[] kernel_local_mem;
     ctx.shared_mem_ptr = nullptr;
 
     expt::ParamMultiplexer::resolve<seq_exec>(launch_reducers);
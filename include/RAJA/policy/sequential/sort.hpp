@@ -72,6 +72,69 @@ struct StableSorter
   }
 };
 
+namespace sequential
+{
+
+/*!
+        \brief sort given range using radix sort if the keys and comparison
+               function allow it, otherwise using sorter
+*/
+template <typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<RAJA::detail::is_radix_sortable<Iter, Compare>>
+sort_keys(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  if (!RAJA::detail::radix_sort(begin, end, comp)) {
+    sorter(begin, end, comp);
+  }
+}
+///
+template <typename Sorter, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+sort_keys(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  sorter(begin, end, comp);
+}
+
+/*!
+        \brief sort given range of pairs using radix sort if the keys and
+               comparison function allow it, otherwise using sorter
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<RAJA::detail::is_radix_sortable<KeyIter, Compare>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  if (!RAJA::detail::radix_sort_pairs(keys_begin, keys_end, vals_begin, comp)) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
+}
+///
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if<concepts::negate<RAJA::detail::is_radix_sortable<KeyIter, Compare>>>
+sort_pairs(Sorter sorter,
+           KeyIter keys_begin,
+           KeyIter keys_end,
+           ValIter vals_begin,
+           Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
+} // namespace sequential
+
 } // namespace detail
 
 /*!
@@ -87,7 +150,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::UnstableSorter{}(begin, end, comp);
+  detail::sequential::sort_keys(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -105,7 +168,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::StableSorter{}(begin, end, comp);
+  detail::sequential::sort_keys(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -124,10 +187,7 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::sequential::sort_pairs(detail::UnstableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -146,10 +206,7 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::sequential::sort_pairs(detail::StableSorter{}, keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
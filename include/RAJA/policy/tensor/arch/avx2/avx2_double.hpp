@@ -138,7 +138,7 @@ namespace expt
       RAJA_INLINE
       self_type &load_packed(element_type const *ptr){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed);
 #endif
         m_value = _mm256_loadu_pd(ptr);
         return *this;
@@ -152,7 +152,7 @@ namespace expt
       RAJA_INLINE
       self_type &load_packed_n(element_type const *ptr, camp::idx_t N){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_packed_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_packed_n);
 #endif
         m_value = _mm256_maskload_pd(ptr, createMask(N));
         return *this;
@@ -165,7 +165,7 @@ namespace expt
       RAJA_INLINE
       self_type &load_strided(element_type const *ptr, camp::idx_t stride){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided);
 #endif
         m_value = _mm256_i64gather_pd(ptr,
                                       createStridedOffsets(stride),
@@ -182,7 +182,7 @@ namespace expt
       RAJA_INLINE
       self_type &load_strided_n(element_type const *ptr, camp::idx_t stride, camp::idx_t N){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
@@ -204,7 +204,7 @@ namespace expt
       RAJA_INLINE
       self_type &gather(element_type const *ptr, int_vector_type offsets){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         m_value = _mm256_i64gather_pd(ptr,
                                       offsets.get_register(),
@@ -224,7 +224,7 @@ namespace expt
       RAJA_INLINE
       self_type &gather_n(element_type const *ptr, int_vector_type offsets, camp::idx_t N){
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_load_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_load_strided_n);
 #endif
         m_value = _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
                                       ptr,
@@ -242,7 +242,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_packed(element_type *ptr) const{
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed);
 #endif
         _mm256_storeu_pd(ptr, m_value);
         return *this;
@@ -255,7 +255,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_packed_n(element_type *ptr, camp::idx_t N) const{
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_packed_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_packed_n);
 #endif
         _mm256_maskstore_pd(ptr, createMask(N), m_value);
         return *this;
@@ -268,7 +268,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_strided(element_type *ptr, camp::idx_t stride) const{
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided);
 #endif
         for(camp::idx_t i = 0;i < 4;++ i){
           ptr[i*stride] = m_value[i];
@@ -284,7 +284,7 @@ namespace expt
       RAJA_INLINE
       self_type const &store_strided_n(element_type *ptr, camp::idx_t stride, camp::idx_t N) const{
 #ifdef RAJA_ENABLE_VECTOR_STATS
-          RAJA::tensor_stats::num_vector_store_strided_n ++;
+          RAJA::expt::tensor_stats::count(RAJA::expt::tensor_stats::num_vector_store_strided_n);
 #endif
         for(camp::idx_t i = 0;i < N;++ i){
           ptr[i*stride] = m_value[i];
@@ -0,0 +1,154 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for the thread pool back-end.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_thread_pool_HPP
+#define RAJA_forall_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <vector>
+
+#include "RAJA/util/plugins.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/ThreadPool.hpp"
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/policy/thread_pool/policy.hpp"
+
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace thread_pool
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// The following function templates split a segment into one contiguous
+// block per pool thread. Each thread runs its block with a private copy
+// of the loop body so reducer copies are combined on that thread.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+  >
+forall_impl(Resource res,
+            const thread_pool_exec &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam f_params)
+{
+  using RAJA::detail::firstIndex;
+  using EXEC_POL = thread_pool_exec;
+
+  RAJA::thread_pool::ThreadPool &pool = RAJA::thread_pool::ThreadPool::get();
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_type = decltype(distance_it);
+
+  // one private parameter pack per thread, combined after the join
+  std::vector<ForallParam> thread_params(pool.num_threads(), f_params);
+  const util::PluginContext* plugin_context = util::current_plugin_context();
+
+  auto task = [&](int tid, int nthreads) {
+    util::PluginThreadScope plugin_scope(plugin_context);
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    ForallParam &params = thread_params[tid];
+    expt::ParamMultiplexer::init<EXEC_POL>(params);
+
+    const diff_type i_begin = firstIndex(distance_it, nthreads, tid);
+    const diff_type i_end = firstIndex(distance_it, nthreads, tid + 1);
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      expt::invoke_body(params, body.get_priv(), begin_it[i]);
+    }
+  };
+  pool.run(task);
+
+  expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  for (ForallParam &params : thread_params) {
+    expt::ParamMultiplexer::combine<EXEC_POL>(f_params, params);
+  }
+  expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+
+  return resources::EventProxy<Resource>(res);
+}
+
+template <typename Iterable, typename Func, typename Resource, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<Resource>,
+  expt::type_traits::is_ForallParamPack<ForallParam>,
+  expt::type_traits::is_ForallParamPack_empty<ForallParam>
+  >
+forall_impl(Resource res,
+            const thread_pool_exec &,
+            Iterable &&iter,
+            Func &&loop_body,
+            ForallParam)
+{
+  using RAJA::detail::firstIndex;
+
+  RAJA_EXTRACT_BED_IT(iter);
+  using diff_type = decltype(distance_it);
+  const util::PluginContext* plugin_context = util::current_plugin_context();
+
+  auto task = [&](int tid, int nthreads) {
+    util::PluginThreadScope plugin_scope(plugin_context);
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    const diff_type i_begin = firstIndex(distance_it, nthreads, tid);
+    const diff_type i_end = firstIndex(distance_it, nthreads, tid + 1);
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      body.get_priv()(begin_it[i]);
+    }
+  };
+  RAJA::thread_pool::ThreadPool::get().run(task);
+
+  return resources::EventProxy<Resource>(res);
+}
+
+}  // namespace thread_pool
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,78 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_thread_pool_HPP
+#define policy_thread_pool_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace thread_pool
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policies
+///
+
+//! split the iteration space into one contiguous block per pool thread
+struct thread_pool_exec
+    : make_policy_pattern_launch_platform_t<Policy::thread_pool,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Index set segment iteration policies
+///
+using thread_pool_segit = thread_pool_exec;
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct thread_pool_reduce
+    : make_policy_pattern_launch_platform_t<Policy::thread_pool,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+}  // namespace thread_pool
+}  // namespace policy
+
+using policy::thread_pool::thread_pool_exec;
+using policy::thread_pool::thread_pool_reduce;
+using policy::thread_pool::thread_pool_segit;
+
+}  // namespace RAJA
+
+#endif
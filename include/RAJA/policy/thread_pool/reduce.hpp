@@ -0,0 +1,131 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for
+ *          thread pool execution.
+ *
+ *          These methods should work on any platform.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_pool_reduce_HPP
+#define RAJA_thread_pool_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <memory>
+#include <mutex>
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/internal/ThreadPool.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/thread_pool/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ * \brief Combiner for thread_pool_reduce reducers.
+ *
+ *        The root reducer holds one padded slot per pool thread, and
+ *        thread-private copies fold their value into the slot of the pool
+ *        thread that destroys them. Copies destroyed by a thread outside
+ *        the pool combine directly into the root under a lock.
+ */
+template <typename T, typename Reduce>
+class ReduceThreadPool
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceThreadPool<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreadPool>;
+
+  PaddedThreadSlots<T> slots;
+  std::unique_ptr<std::mutex> lock;
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceThreadPool() = delete;
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceThreadPool(T init_val, T identity_ = T())
+      : Base(init_val, identity_),
+        slots(RAJA::thread_pool::ThreadPool::get().num_threads(), identity_),
+        lock(new std::mutex)
+  {
+  }
+
+  //! copies are thread-private and combine through the root's slots
+  ReduceThreadPool(ReduceThreadPool const &other) : Base(other) {}
+
+  ~ReduceThreadPool()
+  {
+    if (Base::parent) {
+      root().combine_partial(Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    slots.fill(identity_);
+  }
+
+  T get_combined() const
+  {
+    if (!Base::parent) {
+      for (int i = 0; i < slots.size(); ++i) {
+        Reduce{}(Base::my_data, slots[i]);
+        slots[i] = Base::identity;
+      }
+    }
+    return Base::my_data;
+  }
+
+private:
+  ReduceThreadPool const &root() const
+  {
+    return *static_cast<ReduceThreadPool const *>(Base::parent);
+  }
+
+  void combine_partial(T const &val) const
+  {
+    if (T *slot = slots.slot(RAJA::thread_pool::ThreadPool::thread_id())) {
+      Reduce{}(*slot, val);
+    } else {
+      std::lock_guard<std::mutex> guard(*lock);
+      Reduce{}(Base::my_data, val);
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(thread_pool_reduce, detail::ReduceThreadPool)
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
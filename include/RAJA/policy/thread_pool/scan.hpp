@@ -0,0 +1,240 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_thread_pool_HPP
+#define RAJA_scan_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/internal/ThreadPool.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+#include "RAJA/policy/thread_pool/policy.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+namespace detail
+{
+namespace thread_pool
+{
+
+/*!
+        \brief scan [begin, end) into out with one block per pool thread
+
+        The first pass reduces every block but the last, the block sums are
+        scanned serially, and the second pass scans each block starting from
+        the carry of the blocks before it. in and out may alias.
+        If Exclusive, out[0] = v, otherwise v is unused.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+void scan(Iter begin, Iter end, OutIter out, BinFn f, ValueT const& v)
+{
+  using RAJA::detail::firstIndex;
+  using std::distance;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+
+  RAJA::thread_pool::ThreadPool& pool = RAJA::thread_pool::ThreadPool::get();
+  const int num_blocks = pool.num_threads();
+
+  // carries[b] is the reduction of everything before block b
+  std::vector<ValueT> carries(num_blocks + 1, v);
+
+  auto block_sum = [&](int tid, int nthreads) {
+    for (int b = tid; b < num_blocks - 1; b += nthreads) {
+      const DistanceT i_begin = firstIndex(n, num_blocks, b);
+      const DistanceT i_end = firstIndex(n, num_blocks, b + 1);
+      if (i_begin == i_end) {
+        continue;
+      }
+      ValueT agg = begin[i_begin];
+      for (DistanceT i = i_begin + 1; i < i_end; ++i) {
+        agg = f(agg, begin[i]);
+      }
+      carries[b + 1] = agg;
+    }
+  };
+  pool.run(block_sum);
+
+  // blocks before the first nonempty one have no carry in the inclusive case
+  int first_carry = Exclusive ? 0 : num_blocks;
+  for (int b = 0; b < num_blocks - 1; ++b) {
+    const bool empty = firstIndex(n, num_blocks, b) ==
+                       firstIndex(n, num_blocks, b + 1);
+    if (first_carry > b) {
+      if (!empty) {
+        first_carry = b + 1;
+      }
+    } else if (!empty) {
+      carries[b + 1] = f(carries[b], carries[b + 1]);
+    } else {
+      carries[b + 1] = carries[b];
+    }
+  }
+
+  auto block_scan = [&](int tid, int nthreads) {
+    for (int b = tid; b < num_blocks; b += nthreads) {
+      const DistanceT i_begin = firstIndex(n, num_blocks, b);
+      const DistanceT i_end = firstIndex(n, num_blocks, b + 1);
+      if (i_begin == i_end) {
+        continue;
+      }
+      if (Exclusive) {
+        ValueT agg = carries[b];
+        for (DistanceT i = i_begin; i < i_end; ++i) {
+          ValueT t = begin[i];
+          out[i] = agg;
+          agg = f(agg, t);
+        }
+      } else {
+        ValueT agg = (b >= first_carry) ? f(carries[b], begin[i_begin])
+                                        : ValueT(begin[i_begin]);
+        out[i_begin] = agg;
+        for (DistanceT i = i_begin + 1; i < i_end; ++i) {
+          agg = f(agg, begin[i]);
+          out[i] = agg;
+        }
+      }
+    }
+  };
+  pool.run(block_scan);
+}
+
+}  // namespace thread_pool
+}  // namespace detail
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using ValueT = typename std::remove_reference<decltype(*begin)>::type;
+  if (begin != end) {
+    detail::thread_pool::scan<false>(begin, end, begin, f, ValueT(*begin));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename BinFn, typename ValueT>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+exclusive_inplace(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using DataT = typename std::remove_reference<decltype(*begin)>::type;
+  detail::thread_pool::scan<true>(begin, end, begin, f, DataT(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy, typename Iter, typename OutIter, typename BinFn>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+inclusive(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using ValueT = typename std::remove_reference<decltype(*out)>::type;
+  if (begin != end) {
+    detail::thread_pool::scan<false>(begin, end, out, f, ValueT(*begin));
+  }
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename ExecPolicy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+exclusive(
+    resources::Host host_res,
+    const ExecPolicy &,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using DataT = typename std::remove_reference<decltype(*out)>::type;
+  detail::thread_pool::scan<true>(begin, end, out, f, DataT(v));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,272 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_thread_pool_HPP
+#define RAJA_sort_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+#include "RAJA/internal/ThreadPool.hpp"
+
+#include "RAJA/policy/thread_pool/policy.hpp"
+#include "RAJA/policy/sequential/sort.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+namespace thread_pool
+{
+
+// this number is arbitrary
+constexpr int get_min_iterates_per_thread() { return 128; }
+
+/*!
+        \brief sort given range using sorter and comparison function
+
+        Each pool thread sorts one block, then blocks are merged pairwise,
+        one level at a time, alternating between the range and a buffer.
+        Every block of a level is merged by its own thread using a merge
+        path split, so all threads work at every level. If the buffer
+        cannot be allocated, pairs are merged in place by one thread each.
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+void sort(Sorter sorter,
+          Iter begin,
+          Iter end,
+          Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  constexpr diff_type min_iterates_per_thread = get_min_iterates_per_thread();
+
+  const diff_type n = end - begin;
+
+  RAJA::thread_pool::ThreadPool& pool = RAJA::thread_pool::ThreadPool::get();
+
+  const diff_type num_blocks = std::min(
+      (n + min_iterates_per_thread - 1) / min_iterates_per_thread,
+      static_cast<diff_type>(pool.num_threads()));
+
+  if (num_blocks <= 1) {
+    sorter(begin, end, comp);
+    return;
+  }
+
+  // merge buffer, objects are constructed and destroyed in it by the pool
+  // threads, so it is only freed here
+  host_scratch_ptr<value_type> buf =
+      allocate_host_scratch<value_type>(n);
+  value_type* buf_ptr = buf.get();
+
+  auto sort_blocks = [&](int tid, int nthreads) {
+    for (diff_type b = tid; b < num_blocks; b += nthreads) {
+      const diff_type i_begin = firstIndex(n, num_blocks, b);
+      const diff_type i_end = firstIndex(n, num_blocks, b + 1);
+      sorter(begin + i_begin, begin + i_end, comp);
+      if (buf_ptr != nullptr) {
+        for (diff_type i = i_begin; i < i_end; ++i) {
+          new(&buf_ptr[i]) value_type(std::move(begin[i]));
+        }
+      }
+    }
+  };
+  pool.run(sort_blocks);
+
+  if (buf_ptr == nullptr) {
+
+    // hierarchically merge blocks in place
+    for (diff_type middle_offset = 1; middle_offset < num_blocks; middle_offset *= 2) {
+
+      const diff_type end_offset = 2*middle_offset;
+
+      auto merge_blocks = [&](int tid, int nthreads) {
+        for (diff_type b = tid * end_offset; b < num_blocks; b += nthreads * end_offset) {
+          const diff_type i_begin  = firstIndex(n, num_blocks, b);
+          const diff_type i_middle = firstIndex(n, num_blocks, std::min(b + middle_offset, num_blocks));
+          const diff_type i_end    = firstIndex(n, num_blocks, std::min(b + end_offset,    num_blocks));
+
+          RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+        }
+      };
+      pool.run(merge_blocks);
+    }
+
+    return;
+  }
+
+  std::vector<RAJA::detail::MergeBlockSplit<diff_type>> splits(num_blocks);
+
+  bool in_buf = true;
+  for (diff_type width = 1; width < num_blocks; width *= 2) {
+
+    // every split of a level is found before any block moves out of the
+    // source, the join of each pool run separates the two
+    auto split_blocks = [&](int tid, int nthreads) {
+      for (diff_type b = tid; b < num_blocks; b += nthreads) {
+        splits[b] = in_buf
+            ? RAJA::detail::merge_block_split(buf_ptr, n, num_blocks, b, width, comp)
+            : RAJA::detail::merge_block_split(begin, n, num_blocks, b, width, comp);
+      }
+    };
+    pool.run(split_blocks);
+
+    auto merge_blocks = [&](int tid, int nthreads) {
+      for (diff_type b = tid; b < num_blocks; b += nthreads) {
+        if (in_buf) {
+          RAJA::detail::merge_block_move(buf_ptr, begin, splits[b], comp);
+        } else {
+          RAJA::detail::merge_block_move(begin, buf_ptr, splits[b], comp);
+        }
+      }
+    };
+    pool.run(merge_blocks);
+
+    in_buf = !in_buf;
+  }
+
+  auto finish_blocks = [&](int tid, int nthreads) {
+    for (diff_type b = tid; b < num_blocks; b += nthreads) {
+      const diff_type i_begin = firstIndex(n, num_blocks, b);
+      const diff_type i_end = firstIndex(n, num_blocks, b + 1);
+      if (in_buf) {
+        std::move(buf_ptr + i_begin, buf_ptr + i_end, begin + i_begin);
+      }
+      for (diff_type i = i_begin; i < i_end; ++i) {
+        buf_ptr[i].~value_type();
+      }
+    }
+  };
+  pool.run(finish_blocks);
+}
+
+} // namespace thread_pool
+
+} // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::thread_pool::sort(detail::UnstableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::thread_pool::sort(detail::StableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::thread_pool::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::thread_pool::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,162 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the autotuner used by expt::tuned_forall.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_AutoTuner_HPP
+#define RAJA_AutoTuner_HPP
+
+#include "RAJA/config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+//! tuning state of one kernel for one policy list and range of lengths
+struct TunedKernel {
+  //! the fastest policy once every policy was timed, -1 while tuning
+  std::atomic<int> choice{-1};
+
+  //! name, policy list and length class, used to save the choice
+  std::string key;
+
+  // the rest is guarded by the mutex of the AutoTuner
+  //! set by AutoTuner::reset(), the choice of a retired kernel is not saved
+  bool retired = false;
+  int num_policies = 0;
+  //! calls timed so far, they cycle through the policies
+  int num_timed = 0;
+  //! fastest time of each policy in seconds
+  std::vector<double> best_seconds;
+};
+
+/*!
+ * Picks the fastest policy of a list for each named kernel by timing each
+ * policy for the first calls of the kernel, see expt::tuned_forall.
+ *
+ * Kernels are tuned separately for each policy list and for lengths of the
+ * iteration space that differ by more than a factor of 8. The choices are
+ * saved to the file given with file() or with the environment variable
+ * RAJA_AUTOTUNE_FILE whenever a kernel is tuned, and read from it when the
+ * first kernel is tuned, so later runs start tuned.
+ */
+class AutoTuner
+{
+public:
+  static RAJASHAREDDLL_API AutoTuner& getInstance();
+
+  //! Set the number of times each policy is timed, returns the old number.
+  RAJASHAREDDLL_API int trials(int num_trials);
+  RAJASHAREDDLL_API int trials();
+
+  //! Set the file the choices are saved to, "" to not save them. Choices in
+  //! the file are read before the next kernel is tuned.
+  RAJASHAREDDLL_API void file(const std::string& filename);
+  RAJASHAREDDLL_API std::string file();
+
+  //! The state of a kernel, made on its first call. It stays valid for the
+  //! lifetime of the AutoTuner.
+  RAJASHAREDDLL_API TunedKernel& kernel(const char* name,
+                                        uint64_t list_id,
+                                        int num_policies,
+                                        int length_class);
+
+  //! The policy to time next for a kernel that is being tuned.
+  RAJASHAREDDLL_API int next_policy(TunedKernel& k);
+
+  //! Record a time of a policy, locks in the choice once every policy was
+  //! timed the number of trials.
+  RAJASHAREDDLL_API void record(TunedKernel& k, int policy, double seconds);
+
+  //! Forget all kernels and choices read from the file. Kernels already
+  //! handed out are retired rather than freed, so calls still using them
+  //! finish, but their choices are no longer saved.
+  RAJASHAREDDLL_API void reset();
+
+  //! Bumped by reset(), so callers know cached kernels went away.
+  unsigned generation() const
+  {
+    return m_generation.load(std::memory_order_acquire);
+  }
+
+  //! stable id of a policy list from its type name
+  static uint64_t list_id(const char* type_name)
+  {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char* c = type_name; *c != '\0'; ++c) {
+      hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+    }
+    return hash;
+  }
+
+  //! lengths in [8^c, 8^(c+1)) are in class c, lengths below 8 in class 0
+  static int length_class(long long length)
+  {
+    int c = 0;
+    for (; length >= 8; length /= 8) {
+      ++c;
+    }
+    return c;
+  }
+
+private:
+  AutoTuner();
+
+  void load_locked();
+  std::string format_locked() const;
+  void save(const std::string& filename,
+            const std::string& contents,
+            unsigned long long version);
+
+  std::mutex m_mutex;
+  std::map<std::string, std::unique_ptr<TunedKernel>> m_kernels;
+  //! kernels dropped by reset(), kept as callers may still use them
+  std::vector<std::unique_ptr<TunedKernel>> m_retired;
+  struct saved_choice {
+    int num_policies;
+    int choice;
+    double seconds;
+  };
+
+  //! choices read from the file and made in this run, by key
+  std::map<std::string, saved_choice> m_saved;
+  std::string m_file;
+  bool m_loaded = false;
+  int m_trials = 3;
+  std::atomic<unsigned> m_generation{0};
+  //! numbers the sets of choices to save, so an older set never overwrites
+  //! a newer one
+  unsigned long long m_saved_version = 0;
+
+  //! guards writing the file, which happens outside m_mutex
+  std::mutex m_file_mutex;
+  unsigned long long m_written_version = 0;
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif
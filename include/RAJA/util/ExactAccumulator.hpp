@@ -0,0 +1,221 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file defining an exact, order-independent accumulator
+ *          for floating-point sums.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ExactAccumulator_HPP
+#define RAJA_util_ExactAccumulator_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Exact accumulator for float and double sums.
+ *
+ *         Every finite double is an integer multiple of 2^-1126 once its
+ *         53-bit significand is taken as an integer, so the accumulator keeps
+ *         the running sum as a fixed-point integer split into 32-bit digits
+ *         stored in 64-bit words. The spare high bits of each word absorb
+ *         carries, which are only propagated every few hundred million adds.
+ *
+ *         Because integer addition is associative, the accumulated value,
+ *         and therefore the result of get(), does not depend on the order in
+ *         which values were added or on how partial accumulators were merged.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ExactAccumulator
+{
+  static_assert(std::is_same<T, float>::value ||
+                std::is_same<T, double>::value,
+                "ExactAccumulator supports float and double");
+
+public:
+  using value_type = T;
+
+  static constexpr int digit_bits = 32;
+  static constexpr int num_digits = 70;
+
+  //! bit position of the smallest subnormal significand bit
+  static constexpr int exponent_bias = 1126;
+
+  //! number of unpropagated additions each digit can absorb safely
+  static constexpr std::int64_t max_pending = std::int64_t(1) << 30;
+
+  ExactAccumulator() { clear(); }
+
+  void clear()
+  {
+    for (int i = 0; i < num_digits; ++i) {
+      digits[i] = 0;
+    }
+    pending = 0;
+    has_nan = false;
+    has_pos_inf = false;
+    has_neg_inf = false;
+  }
+
+  //! add a single value
+  void add(T val)
+  {
+    const double x = static_cast<double>(val);
+
+    if (x == 0.0) {
+      return;
+    }
+    if (!std::isfinite(x)) {
+      if (std::isnan(x)) {
+        has_nan = true;
+      } else if (x > 0.0) {
+        has_pos_inf = true;
+      } else {
+        has_neg_inf = true;
+      }
+      return;
+    }
+
+    int exp = 0;
+    const double frac = std::frexp(x, &exp);
+    const bool neg = frac < 0.0;
+    const std::uint64_t mant =
+        static_cast<std::uint64_t>(std::ldexp(neg ? -frac : frac, 53));
+
+    const int bit = exp - 53 + exponent_bias;
+    const int idx = bit / digit_bits;
+    const int shift = bit % digit_bits;
+
+    const std::uint64_t mask = (std::uint64_t(1) << digit_bits) - 1;
+    const std::uint64_t rest = mant >> (digit_bits - shift);
+    const std::int64_t d0 = static_cast<std::int64_t>((mant << shift) & mask);
+    const std::int64_t d1 = static_cast<std::int64_t>(rest & mask);
+    const std::int64_t d2 = static_cast<std::int64_t>(rest >> digit_bits);
+
+    if (neg) {
+      digits[idx] -= d0;
+      digits[idx + 1] -= d1;
+      digits[idx + 2] -= d2;
+    } else {
+      digits[idx] += d0;
+      digits[idx + 1] += d1;
+      digits[idx + 2] += d2;
+    }
+
+    if (++pending >= max_pending) {
+      normalize();
+    }
+  }
+
+  //! add the contents of another accumulator
+  void add(ExactAccumulator const& other)
+  {
+    if (pending + other.pending > max_pending) {
+      normalize();
+    }
+    for (int i = 0; i < num_digits; ++i) {
+      digits[i] += other.digits[i];
+    }
+    pending += other.pending;
+    has_nan = has_nan || other.has_nan;
+    has_pos_inf = has_pos_inf || other.has_pos_inf;
+    has_neg_inf = has_neg_inf || other.has_neg_inf;
+  }
+
+  /*!
+   * \brief Round the exact sum to T.
+   *
+   *        The result is within one ulp of the exact sum and, since it is
+   *        computed from the canonical digit representation, is bitwise
+   *        identical for every order of additions.
+   */
+  T get() const
+  {
+    if (has_nan || (has_pos_inf && has_neg_inf)) {
+      return std::numeric_limits<T>::quiet_NaN();
+    }
+    if (has_pos_inf) {
+      return std::numeric_limits<T>::infinity();
+    }
+    if (has_neg_inf) {
+      return -std::numeric_limits<T>::infinity();
+    }
+
+    ExactAccumulator tmp(*this);
+    tmp.normalize();
+
+    const bool neg = tmp.digits[num_digits - 1] < 0;
+    if (neg) {
+      for (int i = 0; i < num_digits; ++i) {
+        tmp.digits[i] = -tmp.digits[i];
+      }
+      tmp.normalize();
+    }
+
+    int top = num_digits - 1;
+    while (top >= 0 && tmp.digits[top] == 0) {
+      --top;
+    }
+    if (top < 0) {
+      return T(0);
+    }
+
+    // three digits hold more significant bits than a double
+    double result = 0.0;
+    for (int i = (top >= 2 ? top - 2 : 0); i <= top; ++i) {
+      result += std::ldexp(static_cast<double>(tmp.digits[i]),
+                           i * digit_bits - exponent_bias);
+    }
+
+    return static_cast<T>(neg ? -result : result);
+  }
+
+private:
+  std::int64_t digits[num_digits];
+  std::int64_t pending;
+  bool has_nan;
+  bool has_pos_inf;
+  bool has_neg_inf;
+
+  //! propagate carries so every digit but the last lies in [0, 2^digit_bits)
+  void normalize()
+  {
+    const std::int64_t base = std::int64_t(1) << digit_bits;
+    for (int i = 0; i < num_digits - 1; ++i) {
+      const std::int64_t carry = digits[i] >> digit_bits;
+      digits[i] -= carry * base;
+      digits[i + 1] += carry;
+    }
+    pending = 1;
+  }
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
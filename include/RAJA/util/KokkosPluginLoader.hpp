@@ -44,6 +44,8 @@ namespace util {
     std::vector<post_function> post_functions;
     std::vector<finalize_function> finalize_functions;
 
+    bool active = false;
+
   };  // end KokkosPluginLoader class
 
   void linkKokkosPluginLoader();
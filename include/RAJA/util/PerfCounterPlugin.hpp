@@ -0,0 +1,90 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Perf_Counter_Plugin_HPP
+#define RAJA_Perf_Counter_Plugin_HPP
+
+#include <string>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that reads the performance counters of every thread that runs
+   * each kernel, including the other threads of an OpenMP team or thread
+   * pool, with perf_event_open on Linux: cycles, instructions, last level
+   * cache misses, and branch misses, and the task clock and page faults,
+   * which the kernel provides even where the hardware counters are not
+   * exposed, for example in many virtual machines. Counters that can not be
+   * opened are left out.
+   *
+   * It is registered with RAJA but opens no counters until it is enabled,
+   * either with PerfCounterPlugin::enable or by setting the environment
+   * variable RAJA_PERF_COUNTER_PLUGIN to the prefix of the output file.
+   * finalize_plugins() writes <prefix>.csv with the counts of each kernel
+   * name summed over all threads. The counters of a thread are closed when
+   * the thread exits or the plugin is disabled.
+   */
+  class PerfCounterPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    enum counter : int {
+      cycles,
+      instructions,
+      llc_misses,
+      branch_misses,
+      task_clock_ns,
+      page_faults,
+      num_counters
+    };
+
+    PerfCounterPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void preThreadLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postThreadLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Start counting, finalize_plugins() writes prefix.csv.
+    static RAJASHAREDDLL_API void enable(
+        const std::string& prefix = "raja-perf-counters");
+
+    //! Stop counting, drop what was counted and close the counters.
+    static RAJASHAREDDLL_API void disable();
+
+    static RAJASHAREDDLL_API bool enabled();
+
+    //! name of counter c, used as its column in the output
+    static RAJASHAREDDLL_API const char* name(counter c);
+
+    //! Whether counter c can be opened for the calling thread.
+    static RAJASHAREDDLL_API bool available(counter c);
+
+    //! Write the file for what was counted so far, returns false if it
+    //! could not be written.
+    static RAJASHAREDDLL_API bool write();
+
+  };  // end PerfCounterPlugin class
+
+  void linkPerfCounterPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -8,6 +8,15 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <typeinfo>
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
@@ -16,6 +25,30 @@ namespace util {
 
 class KokkosPluginLoader;
 
+namespace detail {
+
+//! number of plugins whose kernel hooks are called, see PluginStrategy
+extern RAJASHAREDDLL_API std::atomic<int> num_active_plugins;
+
+} // closing brace for detail namespace
+
+/*!
+ * Whether any plugin is loaded that wants its kernel hooks called. When
+ * none is, kernels pay for this check and not for the calls.
+ */
+RAJA_INLINE bool plugins_active()
+{
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  return detail::num_active_plugins.load(std::memory_order_relaxed) != 0;
+#else
+  return false;
+#endif
+}
+
+namespace detail {
+struct CurrentPluginContext;
+}
+
 struct PluginContext {
   public:
     PluginContext(const Platform p) :
@@ -23,16 +56,101 @@ struct PluginContext {
 
     Platform platform;
 
+    //! name given with expt::KernelName or to launch, nullptr if none
+    const char* kernel_name = nullptr;
+
+    //! type name of the execution policy, nullptr if not known
+    const char* policy_name = nullptr;
+
+    //! number of iterations in the iteration space, -1 if not known
+    long long num_iterations = -1;
+
+    //! launch dimensions in x, y, z, all 0 if not launched with LaunchParams
+    int teams[3] = {0, 0, 0};
+    int threads[3] = {0, 0, 0};
+
+    //! user declared cost of each iteration, see expt::KernelCost
+    double bytes_per_iteration = 0.0;
+    double flops_per_iteration = 0.0;
+
+    //! kernel_name if given, otherwise policy_name
+    const char* name() const
+    {
+      return kernel_name ? kernel_name : (policy_name ? policy_name : "");
+    }
+
+    //! whether plugins are called with this context, decided once when the
+    //! context is made so the pre and post calls of a kernel stay paired
+    bool hooks_active = true;
+
   private:
     mutable uint64_t kID;
 
+    //! context that was current on the launching thread before this one,
+    //! restored when the kernel returns
+    mutable const PluginContext* enclosing = nullptr;
+
     friend class KokkosPluginLoader;
+    friend struct detail::CurrentPluginContext;
 };
 
+namespace detail {
+
+//! extract the name of T from the signature of type_name<T>
+inline std::string parse_type_name(const char* sig, const char* fallback)
+{
+#if defined(__clang__) || defined(__GNUC__)
+  // "... type_name() [with T = name]" or "... type_name() [T = name]"
+  const char* begin = std::strstr(sig, "T = ");
+  if (begin != nullptr) {
+    std::string name(begin + 4);
+    return name.substr(0, name.find_first_of(";]"));
+  }
+#elif defined(_MSC_VER)
+  // "const char *__cdecl RAJA::util::detail::type_name<name>(void)"
+  std::string s(sig);
+  size_t begin = s.find("type_name<");
+  size_t end = s.rfind(">(void)");
+  if (begin != std::string::npos && end != std::string::npos) {
+    std::string name = s.substr(begin + 10, end - begin - 10);
+    for (const char* prefix : {"struct ", "class "}) {
+      if (name.compare(0, std::strlen(prefix), prefix) == 0) {
+        name.erase(0, std::strlen(prefix));
+      }
+    }
+    return name;
+  }
+#endif
+  RAJA_UNUSED_VAR(sig);
+  return std::string(fallback);
+}
+
+/*!
+ * Get the name of a type as written in the source, e.g.
+ * "RAJA::policy::sequential::seq_exec". The name is computed once per type.
+ */
+template<typename T>
+const char* type_name()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  static const std::string name = parse_type_name(__FUNCSIG__, typeid(T).name());
+#else
+  static const std::string name = parse_type_name(__PRETTY_FUNCTION__, typeid(T).name());
+#endif
+  return name.c_str();
+}
+
+} // closing brace for detail namespace
+
 template<typename Policy>
 PluginContext make_context()
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  PluginContext context{RAJA::detail::get_platform<Policy>::value};
+  context.hooks_active = plugins_active();
+  if (context.hooks_active) {
+    context.policy_name = detail::type_name<Policy>();
+  }
+  return context;
 }
 
 } // closing brace for util namespace
@@ -8,15 +8,27 @@
 #ifndef RAJA_Plugin_Linker_HPP
 #define RAJA_Plugin_Linker_HPP
 
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/PerfCounterPlugin.hpp"
+#include "RAJA/util/RooflinePlugin.hpp"
+#include "RAJA/util/TimingPlugin.hpp"
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#endif
 
 namespace {
   namespace anonymous_RAJA {
     struct pluginLinker {
       inline pluginLinker() {
+        (void)RAJA::util::linkPerfCounterPlugin();
+        (void)RAJA::util::linkRooflinePlugin();
+        (void)RAJA::util::linkTimingPlugin();
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+#endif
       }
     } pluginLinker;
   }
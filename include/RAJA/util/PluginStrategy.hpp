@@ -15,12 +15,21 @@
 namespace RAJA {
 namespace util {
 
+/*!
+ * Base class of plugins. Every plugin object counts as active while it
+ * exists, so kernels call the hooks of the registered plugins only while
+ * at least one plugin is active, see plugins_active.
+ */
 class PluginStrategy
 {
   public:
     RAJASHAREDDLL_API PluginStrategy();
 
-    virtual ~PluginStrategy() = default;
+    RAJASHAREDDLL_API PluginStrategy(const PluginStrategy& other);
+
+    RAJASHAREDDLL_API PluginStrategy& operator=(const PluginStrategy&);
+
+    virtual RAJASHAREDDLL_API ~PluginStrategy();
 
     virtual RAJASHAREDDLL_API void init(const PluginOptions& p);
 
@@ -32,11 +41,54 @@ class PluginStrategy
 
     virtual RAJASHAREDDLL_API void postLaunch(const PluginContext& p);
 
+    //! Called on each thread of a host parallel region that runs part of a
+    //! kernel, other than the thread that launched it, before and after the
+    //! thread runs its part. The launching thread gets preLaunch and
+    //! postLaunch instead, and calls them before the other threads start
+    //! and after they are done.
+    virtual RAJASHAREDDLL_API void preThreadLaunch(const PluginContext& p);
+
+    virtual RAJASHAREDDLL_API void postThreadLaunch(const PluginContext& p);
+
     virtual RAJASHAREDDLL_API void finalize();
+
+  protected:
+    //! Tag for plugins that forward the hooks to the plugins they load, like
+    //! the plugin loaders, which are only active when they loaded something.
+    struct forwarding_tag { };
+
+    explicit RAJASHAREDDLL_API PluginStrategy(forwarding_tag);
+
+    //! Change the number of active plugins by n, for forwarding plugins that
+    //! load plugins which are not PluginStrategy objects.
+    static RAJASHAREDDLL_API void add_active_plugins(int n);
+
+  private:
+    bool m_active;
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
 
+namespace detail {
+
+//! The context of the kernel the calling thread runs, nullptr if none,
+//! made current by callPreLaunchPlugins and callPostLaunchPlugins.
+struct CurrentPluginContext
+{
+  static RAJASHAREDDLL_API const PluginContext*& get();
+
+  static void push(const PluginContext& p)
+  {
+    const PluginContext*& current = get();
+    p.enclosing = current;
+    current = &p;
+  }
+
+  static void pop(const PluginContext& p) { get() = p.enclosing; }
+};
+
+}  // closing brace for detail namespace
+
 } // closing brace for util namespace
 } // closing brace for RAJA namespace
 
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Roofline_Plugin_HPP
+#define RAJA_Roofline_Plugin_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginOptions.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that reports the achieved memory bandwidth and flop rate of
+   * kernels annotated with expt::KernelCost. It is registered with RAJA but
+   * records nothing until it is enabled, either with RooflinePlugin::enable
+   * or by setting the environment variable RAJA_ROOFLINE_PLUGIN to the
+   * prefix of the output file.
+   *
+   * The peaks are only known if they are set with set_peak_bandwidth and
+   * set_peak_flops, or if the bandwidth is measured with calibrate. Setting
+   * the environment variable RAJA_ROOFLINE_CALIBRATE calibrates when the
+   * plugins are initialized. Without peaks the fractions are left empty.
+   * finalize_plugins() writes <prefix>.csv, one row per kernel name with its
+   * time, rates, and fractions of the peaks.
+   */
+  class RooflinePlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    RooflinePlugin();
+
+    void init(const RAJA::util::PluginOptions& p) override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Start recording kernels, finalize_plugins() writes prefix.csv.
+    static RAJASHAREDDLL_API void enable(
+        const std::string& prefix = "raja-roofline");
+
+    //! Stop recording kernels and drop what was recorded.
+    static RAJASHAREDDLL_API void disable();
+
+    static RAJASHAREDDLL_API bool enabled();
+
+    //! Peaks in bytes and flops per second, 0 if not known.
+    static RAJASHAREDDLL_API double peak_bandwidth();
+    static RAJASHAREDDLL_API double peak_flops();
+
+    static RAJASHAREDDLL_API void set_peak_bandwidth(double bytes_per_second);
+    static RAJASHAREDDLL_API void set_peak_flops(double flops_per_second);
+
+    //! Measure the host bandwidth with a STREAM triad over three arrays of
+    //! array_size doubles, 96 MiB by default, sets and returns the peak
+    //! bandwidth. Use arrays several times larger than the last level cache.
+    static RAJASHAREDDLL_API double calibrate(
+        size_t array_size = size_t(1) << 22);
+
+    //! Write the file for what was recorded so far, returns false if it
+    //! could not be written.
+    static RAJASHAREDDLL_API bool write();
+
+  };  // end RooflinePlugin class
+
+  void linkRooflinePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
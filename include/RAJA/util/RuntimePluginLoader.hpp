@@ -34,6 +34,10 @@ namespace util {
 
     void postLaunch(const RAJA::util::PluginContext& p) override;
 
+    void preThreadLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postThreadLaunch(const RAJA::util::PluginContext& p) override;
+
     void finalize() override;
 
   private:
@@ -0,0 +1,77 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Timing_Plugin_HPP
+#define RAJA_Timing_Plugin_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/PluginContext.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that times every kernel on the host thread that runs it. It is
+   * registered with RAJA but records nothing until it is enabled, either with
+   * TimingPlugin::enable or by setting the environment variable
+   * RAJA_TIMING_PLUGIN to the prefix of the output files.
+   *
+   * Each thread records into its own buffers without locks, and publishes
+   * what it recorded for write to read. finalize_plugins() writes
+   * <prefix>.json, the kernels as Chrome trace events, and <prefix>.csv, the
+   * count, total, min, max, and mean time of each kernel name per thread and
+   * over all threads.
+   *
+   * enable, disable, and write may be called while other threads run
+   * kernels. write includes the kernels that finished before it was called.
+   * enable and disable drop what was recorded; kernels running at that time
+   * are not recorded, and threads keep the buffers they were recording into
+   * until they next run a kernel or exit.
+   */
+  class TimingPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    //! trace events kept per thread, kernels past that are only summarized
+    static constexpr size_t default_max_events = size_t(1) << 20;
+
+    TimingPlugin();
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Start timing kernels, finalize_plugins() writes the files for prefix.
+    static RAJASHAREDDLL_API void enable(
+        const std::string& prefix = "raja-timing",
+        size_t max_events = default_max_events);
+
+    //! Stop timing kernels and drop what was recorded.
+    static RAJASHAREDDLL_API void disable();
+
+    static RAJASHAREDDLL_API bool enabled();
+
+    //! Write the files for what was recorded so far, returns false if a file
+    //! could not be written.
+    static RAJASHAREDDLL_API bool write();
+
+  };  // end TimingPlugin class
+
+  void linkTimingPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -18,14 +18,20 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
-#include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <list>
-#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
-#include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
 
 namespace RAJA
@@ -37,38 +43,109 @@ namespace basic_mempool
 namespace detail
 {
 
+//! index of the most significant set bit of value, value must not be 0
+inline unsigned highest_set_bit(size_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(sizeof(unsigned long long) * CHAR_BIT - 1 -
+                               __builtin_clzll(value));
+#else
+  unsigned bit = 0;
+  while (value >>= 1) {
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+//! index of the least significant set bit of value, value must not be 0
+inline unsigned lowest_set_bit(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctz(value));
+#else
+  unsigned bit = 0;
+  while (!(value & 1u)) {
+    value >>= 1;
+    ++bit;
+  }
+  return bit;
+#endif
+}
+
+//! number of bins in the allocation size histograms of MemPool
+static constexpr size_t num_size_bins = 64;
+
+//! bin 0 holds 0 bytes, bin b holds sizes in [2^(b-1), 2^b)
+inline size_t size_bin(size_t nbytes)
+{
+  return (nbytes == 0) ? 0
+                       : std::min(static_cast<size_t>(highest_set_bit(nbytes)) +
+                                      1,
+                                  num_size_bins - 1);
+}
+
 
 /*! \class MemoryArena
  ******************************************************************************
  *
- * \brief  MemoryArena is a map based subclass for class MemPool
- * provides book-keeping to divy a large chunk of pre-allocated memory to avoid
- * the overhead of  malloc/free or cudaMalloc/cudaFree, etc
+ * \brief  MemoryArena is a two level segregated fit (TLSF) subclass for
+ * class MemPool that provides book-keeping to divy a large chunk of
+ * pre-allocated memory to avoid the overhead of malloc/free or
+ * cudaMalloc/cudaFree, etc
  *
  * get/give are the primary calls used by class MemPool to get aligned memory
  * from the pool or give it back
  *
+ * The arena is split into granules of at least min_granularity bytes and
+ * blocks of whole granules are kept in free lists segregated by size class.
+ * Bitmaps over the non-empty free lists let get find a large enough block
+ * and give coalesce a block with its free neighbors in constant time.
+ *
+ * Block headers live in a host side table indexed by granule and allocated
+ * with the arena, so the arena never reads or writes the memory it manages.
+ * This keeps device memory and pre-zeroed memory usable and means get/give
+ * do no heap allocation of their own.
  *
  ******************************************************************************
  */
 class MemoryArena
 {
 public:
-  using free_type = std::map<void*, void*>;
-  using free_value_type = typename free_type::value_type;
-  using used_type = std::map<void*, void*>;
-  using used_value_type = typename used_type::value_type;
+  //! smallest granule, blocks start on granule boundaries
+  static constexpr size_t min_granularity = 256;
+
+  //! larger arenas use larger granules to bound the size of the block table
+  static constexpr size_t max_granules = size_t(1) << 17;
 
   MemoryArena(void* ptr, size_t size)
-    : m_allocation{ ptr, static_cast<char*>(ptr)+size },
-      m_free_space(),
-      m_used_space()
+    : m_allocation{ ptr, static_cast<char*>(ptr)+size }
   {
-     m_free_space[ptr] = static_cast<char*>(ptr)+size ;
     if (m_allocation.begin == nullptr) {
       fprintf(stderr, "Attempt to create MemoryArena with no memory");
       std::abort();
     }
+
+    const size_t granularity = granularity_for(size);
+    m_granularity_shift = highest_set_bit(granularity);
+
+    const size_t padding = align_padding(ptr, granularity);
+    m_base = static_cast<char*>(ptr) + padding;
+    m_num_granules = static_cast<uint32_t>(
+        (padding < size) ? (size - padding) >> m_granularity_shift : 0);
+
+    m_blocks.reset(new block_type[m_num_granules + 1]());
+    for (uint32_t fl = 0; fl < fl_count; ++fl) {
+      for (uint32_t sl = 0; sl < sl_count; ++sl) {
+        m_free_heads[fl][sl] = npos;
+      }
+    }
+
+    if (m_num_granules > 0) {
+      m_blocks[0].size = m_num_granules;
+      m_blocks[0].prev = npos;
+      insert_free(0);
+    }
   }
 
   MemoryArena(MemoryArena const&) = delete;
@@ -77,62 +154,177 @@ public:
   MemoryArena(MemoryArena&&) = default;
   MemoryArena& operator=(MemoryArena&&) = default;
 
+  /*!
+   * \brief  Get the size of an arena that can satisfy get(nbytes, alignment)
+   *         wherever the arena memory starts.
+   */
+  static size_t required_capacity(size_t nbytes, size_t alignment)
+  {
+    size_t size = nbytes + alignment;
+    for (;;) {
+      const size_t granularity = granularity_for(size);
+      const size_t needed = (granularity - 1) +
+                            granules_for(nbytes, alignment, granularity) *
+                                granularity;
+      if (needed <= size) {
+        return size;
+      }
+      size = needed;
+    }
+  }
+
   size_t capacity()
   {
     return static_cast<char*>(m_allocation.end) -
            static_cast<char*>(m_allocation.begin);
   }
 
-  bool unused() { return m_used_space.empty(); }
+  bool unused() { return m_num_used == 0; }
 
-  void* get_allocation() { return m_allocation.begin; }
+  //! bytes in blocks handed out by get
+  size_t used_bytes() const
+  {
+    return static_cast<size_t>(m_used_granules) << m_granularity_shift;
+  }
 
-  void* get(size_t nbytes, size_t alignment)
+  //! true if ptr points into the memory of the arena
+  bool contains(const void* ptr) const
   {
-    void* ptr_out = nullptr;
-    if (capacity() >= nbytes) {
-      free_type::iterator end = m_free_space.end();
-      for (free_type::iterator iter = m_free_space.begin(); iter != end;
-           ++iter) {
+    return m_allocation.begin <= ptr && ptr < m_allocation.end;
+  }
 
-        void* adj_ptr = iter->first;
-        size_t cap =
-            static_cast<char*>(iter->second) - static_cast<char*>(adj_ptr);
+  //! bytes in the block starting at ptr, which get returned
+  size_t block_size(const void* ptr) const
+  {
+    return static_cast<size_t>(m_blocks[block_index(ptr)].size)
+           << m_granularity_shift;
+  }
 
-        if (::RAJA::align(alignment, nbytes, adj_ptr, cap)) {
+  //! owner tag of the block starting at ptr, which get returned, 0 if none
+  uint32_t owner(const void* ptr) const
+  {
+    return m_blocks[block_index(ptr)].owner;
+  }
 
-          ptr_out = adj_ptr;
+  /*!
+   * \brief  Tag the block starting at ptr, which get returned, with a
+   *         non-zero owner. give clears the tag.
+   *
+   * The tag of a block is only written while the block is handed out, so
+   * whoever holds the block may read it without a lock.
+   */
+  void set_owner(const void* ptr, uint32_t owner)
+  {
+    m_blocks[block_index(ptr)].owner = owner;
+  }
 
-          remove_free_chunk(iter,
-                            adj_ptr,
-                            static_cast<char*>(adj_ptr) + nbytes);
+  //! clear the owner tags of all blocks, walks every block of the arena
+  void clear_owners()
+  {
+    for (uint32_t block = 0; block < m_num_granules;
+         block += m_blocks[block].size) {
+      m_blocks[block].owner = 0;
+    }
+  }
 
-          add_used_chunk(adj_ptr, static_cast<char*>(adj_ptr) + nbytes);
+  //! bytes in free blocks
+  size_t free_bytes() const
+  {
+    return static_cast<size_t>(m_num_granules - m_used_granules)
+           << m_granularity_shift;
+  }
 
-          break;
-        }
-      }
+  //! bytes in the largest free block, walks one free list
+  size_t largest_free_block() const
+  {
+    if (m_fl_bitmap == 0) {
+      return 0;
+    }
+    const uint32_t fl = highest_set_bit(m_fl_bitmap);
+    const uint32_t sl = highest_set_bit(m_sl_bitmap[fl]);
+    uint32_t largest = 0;
+    for (uint32_t block = m_free_heads[fl][sl]; block != npos;
+         block = m_blocks[block].next_free) {
+      largest = std::max(largest, static_cast<uint32_t>(m_blocks[block].size));
     }
-    return ptr_out;
+    return static_cast<size_t>(largest) << m_granularity_shift;
   }
 
-  bool give(void* ptr)
+  void* get_allocation() { return m_allocation.begin; }
+
+  void* get(size_t nbytes, size_t alignment)
   {
-    if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
+    const size_t granularity = size_t(1) << m_granularity_shift;
+    const size_t request = granules_for(nbytes, alignment, granularity);
+    if (request > m_num_granules) {
+      return nullptr;
+    }
 
-      used_type::iterator found = m_used_space.find(ptr);
+    uint32_t block = take_free(static_cast<uint32_t>(request));
+    if (block == npos) {
+      return nullptr;
+    }
 
-      if (found != m_used_space.end()) {
+    char* ptr = granule_ptr(block);
+
+    if (alignment > granularity) {
+      // return the leading padding to the free lists
+      const uint32_t lead = static_cast<uint32_t>(
+          align_padding(ptr, alignment) >> m_granularity_shift);
+      if (lead > 0) {
+        const uint32_t aligned = split(block, lead);
+        insert_free(block);
+        block = aligned;
+        ptr = granule_ptr(block);
+      }
+    }
 
-        add_free_chunk(found->first, found->second);
+    const uint32_t used = static_cast<uint32_t>(
+        (std::max(nbytes, size_t(1)) + granularity - 1) >> m_granularity_shift);
+    if (m_blocks[block].size > used) {
+      insert_free(split(block, used));
+    }
 
-        m_used_space.erase(found);
+    m_blocks[block].state = block_used;
+    ++m_num_used;
+    m_used_granules += m_blocks[block].size;
+    return ptr;
+  }
 
-      } else {
+  bool give(void* ptr)
+  {
+    if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
+
+      const char* cptr = static_cast<char*>(ptr);
+      const size_t offset = static_cast<size_t>(cptr - m_base);
+      const uint32_t block =
+          static_cast<uint32_t>(offset >> m_granularity_shift);
+
+      if (cptr < m_base ||
+          (static_cast<size_t>(block) << m_granularity_shift) != offset ||
+          block >= m_num_granules || m_blocks[block].state != block_used) {
         fprintf(stderr, "Invalid free %p", ptr);
         std::abort();
       }
 
+      --m_num_used;
+      m_used_granules -= m_blocks[block].size;
+      m_blocks[block].owner = 0;
+
+      uint32_t freed = block;
+      const uint32_t next = block + m_blocks[block].size;
+      if (next < m_num_granules && m_blocks[next].state == block_free) {
+        remove_free(next);
+        merge(freed, next);
+      }
+      const uint32_t prev = m_blocks[block].prev;
+      if (prev != npos && m_blocks[prev].state == block_free) {
+        remove_free(prev);
+        merge(prev, freed);
+        freed = prev;
+      }
+      insert_free(freed);
+
       return true;
     } else {
       return false;
@@ -140,108 +332,589 @@ public:
   }
 
 private:
+  static constexpr uint32_t npos = ~uint32_t(0);
+
+  //! number of second level lists per power of two, as log2
+  static constexpr uint32_t sl_shift = 4;
+  static constexpr uint32_t sl_count = uint32_t(1) << sl_shift;
+  static constexpr uint32_t fl_count = 32;
+
+  enum block_state : uint32_t {
+    block_none = 0,  //!< granule is not the start of a block
+    block_free,
+    block_used
+  };
+
+  //! header of the block starting at a granule, sizes are in granules
+  struct block_type {
+    uint32_t size : 30;
+    uint32_t state : 2;
+    uint32_t prev;       //!< physically preceding block
+    uint32_t next_free;  //!< free list links, only valid for free blocks
+    uint32_t prev_free;
+    uint32_t owner;      //!< see set_owner, 0 unless handed out and tagged
+  };
+
   struct memory_chunk {
     void* begin;
     void* end;
   };
 
-  void add_free_chunk(void* begin, void* end)
+  static size_t granularity_for(size_t size)
+  {
+    size_t granularity = min_granularity;
+    while (size / granularity > max_granules) {
+      granularity *= 2;
+    }
+    return granularity;
+  }
+
+  static size_t align_padding(const void* ptr, size_t alignment)
   {
-    // integrates a chunk of memory into free_space
-    free_type::iterator invl = m_free_space.end();
-    free_type::iterator next = m_free_space.lower_bound(begin);
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+    return static_cast<size_t>((alignment - (addr & (alignment - 1))) &
+                               (alignment - 1));
+  }
 
-    // check if prev exists
-    if (next != m_free_space.begin()) {
-      // check if prev can cover [begin, end)
-      free_type::iterator prev = next;
-      --prev;
-      if (prev->second == begin) {
-        // extend prev to cover [begin, end)
-        prev->second = end;
+  //! granules to take from the free lists so an aligned block fits
+  static size_t granules_for(size_t nbytes, size_t alignment,
+                             size_t granularity)
+  {
+    size_t granules =
+        (std::max(nbytes, size_t(1)) + granularity - 1) / granularity;
+    if (alignment > granularity) {
+      granules += alignment / granularity - 1;
+    }
+    return granules;
+  }
 
-        // check if prev can cover next too
-        if (next != invl) {
-          assert(next->first != begin);
+  uint32_t block_index(const void* ptr) const
+  {
+    const size_t offset = static_cast<size_t>(static_cast<const char*>(ptr) -
+                                              m_base);
+    return static_cast<uint32_t>(offset >> m_granularity_shift);
+  }
 
-          if (next->first == end) {
-            // extend prev to cover next too
-            prev->second = next->second;
+  char* granule_ptr(uint32_t block)
+  {
+    return m_base + (static_cast<size_t>(block) << m_granularity_shift);
+  }
 
-            // remove redundant next
-            m_free_space.erase(next);
-          }
+  //! first and second level list holding free blocks of size granules
+  static void mapping_insert(uint32_t size, uint32_t& fl, uint32_t& sl)
+  {
+    if (size < sl_count) {
+      fl = 0;
+      sl = size;
+    } else {
+      const uint32_t log2 = highest_set_bit(size);
+      fl = log2 - sl_shift + 1;
+      sl = (size >> (log2 - sl_shift)) ^ sl_count;
+    }
+  }
+
+  //! round size up to the smallest size of the next size class
+  static size_t round_up_size(size_t size)
+  {
+    if (size >= sl_count) {
+      const size_t step = size_t(1) << (highest_set_bit(size) - sl_shift);
+      size = (size + step - 1) & ~(step - 1);
+    }
+    return size;
+  }
+
+  void insert_free(uint32_t block)
+  {
+    uint32_t fl, sl;
+    mapping_insert(m_blocks[block].size, fl, sl);
+
+    const uint32_t head = m_free_heads[fl][sl];
+    m_blocks[block].state = block_free;
+    m_blocks[block].next_free = head;
+    m_blocks[block].prev_free = npos;
+    if (head != npos) {
+      m_blocks[head].prev_free = block;
+    }
+    m_free_heads[fl][sl] = block;
+    m_fl_bitmap |= uint32_t(1) << fl;
+    m_sl_bitmap[fl] |= uint32_t(1) << sl;
+  }
+
+  void remove_free(uint32_t block)
+  {
+    uint32_t fl, sl;
+    mapping_insert(m_blocks[block].size, fl, sl);
+
+    const uint32_t next = m_blocks[block].next_free;
+    const uint32_t prev = m_blocks[block].prev_free;
+    if (next != npos) {
+      m_blocks[next].prev_free = prev;
+    }
+    if (prev != npos) {
+      m_blocks[prev].next_free = next;
+    } else {
+      m_free_heads[fl][sl] = next;
+      if (next == npos) {
+        m_sl_bitmap[fl] &= ~(uint32_t(1) << sl);
+        if (m_sl_bitmap[fl] == 0) {
+          m_fl_bitmap &= ~(uint32_t(1) << fl);
         }
-        return;
       }
     }
+    m_blocks[block].state = block_none;
+  }
 
-    if (next != invl) {
-      assert(next->first != begin);
-
-      if (next->first == end) {
-        // extend next to cover [begin, end)
-        m_free_space.insert(next, free_value_type{begin, next->second});
-        m_free_space.erase(next);
+  //! remove and return a free block of at least size granules, or npos
+  uint32_t take_free(uint32_t size)
+  {
+    uint32_t fl, sl;
+    mapping_insert(static_cast<uint32_t>(round_up_size(size)), fl, sl);
+
+    uint32_t sl_map = m_sl_bitmap[fl] & (~uint32_t(0) << sl);
+    if (sl_map == 0) {
+      const uint32_t fl_map =
+          (fl + 1 < fl_count) ? m_fl_bitmap & (~uint32_t(0) << (fl + 1)) : 0;
+      if (fl_map != 0) {
+        fl = lowest_set_bit(fl_map);
+        sl_map = m_sl_bitmap[fl];
+      }
+    }
 
-        return;
+    uint32_t block = npos;
+    if (sl_map != 0) {
+      block = m_free_heads[fl][lowest_set_bit(sl_map)];
+    } else {
+      // no class is sure to fit, try the head of the class holding size
+      mapping_insert(size, fl, sl);
+      const uint32_t head = m_free_heads[fl][sl];
+      if (head != npos && m_blocks[head].size >= size) {
+        block = head;
       }
     }
 
-    // no free space adjacent to this chunk, add seperate free chunk [begin,
-    // end)
-    m_free_space.insert(next, free_value_type{begin, end});
+    if (block != npos) {
+      remove_free(block);
+    }
+    return block;
   }
 
-  void remove_free_chunk(free_type::iterator iter, void* begin, void* end)
+  //! split off the end of block after size granules and return it
+  uint32_t split(uint32_t block, uint32_t size)
   {
+    const uint32_t rest = block + size;
+    m_blocks[rest].size = m_blocks[block].size - size;
+    m_blocks[rest].state = block_none;
+    m_blocks[rest].prev = block;
+    m_blocks[block].size = size;
+
+    const uint32_t next = rest + m_blocks[rest].size;
+    if (next < m_num_granules) {
+      m_blocks[next].prev = rest;
+    }
+    return rest;
+  }
 
-    void* ptr = iter->first;
-    void* ptr_end = iter->second;
+  //! merge block next into the physically preceding block
+  void merge(uint32_t block, uint32_t next)
+  {
+    m_blocks[block].size += m_blocks[next].size;
+    m_blocks[next].size = 0;
+    m_blocks[next].state = block_none;
 
-    // fixup m_free_space, shrinking and adding chunks as needed
-    if (ptr != begin) {
+    const uint32_t after = block + m_blocks[block].size;
+    if (after < m_num_granules) {
+      m_blocks[after].prev = block;
+    }
+  }
+
+  memory_chunk m_allocation;
+  char* m_base;
+  unsigned m_granularity_shift;
+  uint32_t m_num_granules;
+  size_t m_num_used = 0;
+  uint32_t m_used_granules = 0;
 
-      // shrink end of current free region to [ptr, begin)
-      iter->second = begin;
+  std::unique_ptr<block_type[]> m_blocks;
 
-      if (end != ptr_end) {
+  uint32_t m_fl_bitmap = 0;
+  uint32_t m_sl_bitmap[fl_count] = {};
+  uint32_t m_free_heads[fl_count][sl_count];
+};
 
-        // insert free region [end, ptr_end) after current free region
-        free_type::iterator next = iter;
-        ++next;
-        m_free_space.insert(next, free_value_type{end, ptr_end});
-      }
 
-    } else if (end != ptr_end) {
+/*! \class ThreadCache
+ ******************************************************************************
+ *
+ * \brief  ThreadCache holds small blocks taken from a MemPool for the use of
+ * one thread so that most malloc/free calls made by that thread do not need
+ * the lock of the pool.
+ *
+ * Blocks are kept in free stacks by power of two size class. The pool tags
+ * the arena header of every block a cache owns with the index of the cache
+ * and the size class, so a block freed by any thread goes back to the
+ * owning cache without a search. The cache only keeps its free blocks, the
+ * blocks it handed out are found by their tags, so there is no limit on
+ * how many blocks a cache owns. The cache does no heap allocation after it
+ * is created.
+ *
+ * The owning MemPool moves blocks between a cache and its arenas in batches
+ * and locks the cache while doing so.
+ *
+ ******************************************************************************
+ */
+class ThreadCache
+{
+public:
+  static constexpr size_t num_classes = 5;
+  static constexpr size_t min_class_size = MemoryArena::min_granularity;
+  static constexpr size_t max_class_size = min_class_size
+                                           << (num_classes - 1);
+
+  //! free blocks kept per size class
+  static constexpr size_t class_capacity = 32;
 
-      // shrink beginning of current free region to [end, ptr_end)
-      free_type::iterator next = iter;
-      ++next;
-      m_free_space.insert(next, free_value_type{end, ptr_end});
-      m_free_space.erase(iter);
+  //! blocks taken from the pool at once to refill a size class
+  static constexpr size_t batch_size = 8;
 
-    } else {
+  ThreadCache(std::thread::id owner, size_t index)
+      : m_owner(owner), m_index(index)
+  {
+  }
+
+  ThreadCache(ThreadCache const&) = delete;
+  ThreadCache& operator=(ThreadCache const&) = delete;
+
+  static size_t size_class(size_t nbytes)
+  {
+    return (nbytes <= min_class_size)
+               ? 0
+               : highest_set_bit(nbytes - 1) + 1 -
+                     highest_set_bit(min_class_size);
+  }
+
+  static size_t class_size(size_t cls) { return min_class_size << cls; }
+
+  std::thread::id owner() const { return m_owner; }
 
-      // can not reuse current region, erase
-      m_free_space.erase(iter);
+  //! position of the cache in its pool
+  size_t index() const { return m_index; }
+
+  std::mutex& mutex() { return m_mutex; }
+
+  //! bytes in free blocks
+  size_t held_bytes() const { return m_held_bytes; }
+
+  size_t num_free(size_t cls) const { return m_num_free[cls]; }
+
+  //! take a free block of the given class, or nullptr
+  void* pop(size_t cls)
+  {
+    if (m_num_free[cls] == 0) {
+      return nullptr;
     }
+    m_held_bytes -= class_size(cls);
+    return m_free[cls][--m_num_free[cls]];
   }
 
-  void add_used_chunk(void* begin, void* end)
+  //! keep a free block that the cache owns, the class must not be full
+  void push(void* ptr, size_t cls)
   {
-    // simply inserts a chunk of memory into used_space
-    m_used_space.insert(used_value_type{begin, end});
+    m_held_bytes += class_size(cls);
+    m_free[cls][m_num_free[cls]++] = ptr;
   }
 
-  memory_chunk m_allocation;
-  free_type m_free_space;
-  used_type m_used_space;
+  //! count a malloc or free served by the cache
+  void count_malloc(size_t nbytes)
+  {
+    ++m_num_mallocs;
+    ++m_malloc_sizes[size_bin(nbytes)];
+  }
+
+  void count_free() { ++m_num_frees; }
+
+  size_t num_mallocs() const { return m_num_mallocs; }
+
+  size_t num_frees() const { return m_num_frees; }
+
+  size_t malloc_sizes(size_t bin) const { return m_malloc_sizes[bin]; }
+
+  void reset_counts()
+  {
+    m_num_mallocs = 0;
+    m_num_frees = 0;
+    for (size_t bin = 0; bin < num_size_bins; ++bin) {
+      m_malloc_sizes[bin] = 0;
+    }
+  }
+
+  //! forget all blocks without giving them back
+  void clear()
+  {
+    for (size_t cls = 0; cls < num_classes; ++cls) {
+      m_num_free[cls] = 0;
+    }
+    m_held_bytes = 0;
+  }
+
+private:
+  std::mutex m_mutex;
+  std::thread::id m_owner;
+  size_t m_index;
+
+  size_t m_held_bytes = 0;
+  size_t m_num_mallocs = 0;
+  size_t m_num_frees = 0;
+  size_t m_malloc_sizes[num_size_bins] = {};
+  size_t m_num_free[num_classes] = {};
+  void* m_free[num_classes][class_capacity];
 };
 
+//! interface used to flush thread caches without knowing the allocator
+class ThreadCachedPool
+{
+public:
+  virtual void flush_thread_cache() = 0;
+
+protected:
+  ~ThreadCachedPool() = default;
+};
+
+/*!
+ * Pools with thread caching enabled. The pools are kept in slots with an
+ * atomic count, like the caches of a pool, so threads leaving a parallel
+ * region read them without a lock. Only adding and removing pools takes
+ * the mutex. Removed pools leave an empty slot that the next added pool
+ * reuses.
+ *
+ * Slots are allocated in chunks as pools are added and never freed, so
+ * they do not move while being read. Each slot counts the threads flushing
+ * its pool, and removing a pool waits for them to finish, so a pool may be
+ * destroyed or disable caching while other threads leave parallel regions.
+ */
+struct ThreadCacheRegistry {
+  static constexpr size_t chunk_size = 64;
+  static constexpr size_t max_chunks = 64;
+  //! most pools with caching enabled at the same time
+  static constexpr size_t max_pools = chunk_size * max_chunks;
+
+  struct slot_type {
+    std::atomic<ThreadCachedPool*> pool{nullptr};
+    std::atomic<size_t> num_flushing{0};
+  };
+
+  std::mutex mutex;
+  std::atomic<slot_type*> chunks[max_chunks] = {};
+  //! one past the last slot in use
+  std::atomic<size_t> num_pools{0};
+
+  static ThreadCacheRegistry& get()
+  {
+    // never destroyed so pools may unregister during static destruction
+    static ThreadCacheRegistry* registry = new ThreadCacheRegistry;
+    return *registry;
+  }
+
+  //! slot i, which must be below num_pools
+  slot_type& slot(size_t i)
+  {
+    slot_type* chunk = chunks[i / chunk_size].load(std::memory_order_acquire);
+    return chunk[i % chunk_size];
+  }
+
+  //! call f with every registered pool, which stays registered meanwhile
+  template <typename Func>
+  void for_each(Func&& f)
+  {
+    const size_t num = num_pools.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num; ++i) {
+      slot_type& s = slot(i);
+      // announce the read before loading the pool, remove stores the empty
+      // pool before waiting for the count, so one of them sees the other
+      s.num_flushing.fetch_add(1, std::memory_order_seq_cst);
+      ThreadCachedPool* pool = s.pool.load(std::memory_order_seq_cst);
+      if (pool != nullptr) {
+        f(pool);
+      }
+      s.num_flushing.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  void add(ThreadCachedPool* pool)
+  {
+    lock_guard<std::mutex> lock(mutex);
+    const size_t num = num_pools.load(std::memory_order_relaxed);
+    size_t free_slot = num;
+    for (size_t i = 0; i < num; ++i) {
+      ThreadCachedPool* registered =
+          slot(i).pool.load(std::memory_order_relaxed);
+      if (registered == pool) {
+        return;
+      }
+      if (registered == nullptr && free_slot == num) {
+        free_slot = i;
+      }
+    }
+    if (free_slot == max_pools) {
+      fprintf(stderr,
+              "RAJA::basic_mempool: more than %zu pools with thread caching "
+              "enabled\n",
+              max_pools);
+      std::abort();
+    }
+    if (free_slot % chunk_size == 0 &&
+        chunks[free_slot / chunk_size].load(std::memory_order_relaxed) ==
+            nullptr) {
+      chunks[free_slot / chunk_size].store(new slot_type[chunk_size],
+                                           std::memory_order_release);
+    }
+    slot(free_slot).pool.store(pool, std::memory_order_seq_cst);
+    if (free_slot == num) {
+      num_pools.store(num + 1, std::memory_order_release);
+    }
+  }
+
+  //! unregister pool, returns once no thread flushes it any more
+  void remove(ThreadCachedPool* pool)
+  {
+    lock_guard<std::mutex> lock(mutex);
+    size_t num = num_pools.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < num; ++i) {
+      slot_type& s = slot(i);
+      if (s.pool.load(std::memory_order_relaxed) == pool) {
+        s.pool.store(nullptr, std::memory_order_seq_cst);
+        while (s.num_flushing.load(std::memory_order_seq_cst) != 0) {
+          std::this_thread::yield();
+        }
+      }
+    }
+    while (num > 0 &&
+           slot(num - 1).pool.load(std::memory_order_relaxed) == nullptr) {
+      --num;
+    }
+    num_pools.store(num, std::memory_order_release);
+  }
+};
+
+//! get a MemPool identifier that is never reused
+inline unsigned long long next_pool_id()
+{
+  static std::atomic<unsigned long long> id{0};
+  return ++id;
+}
+
 } /* end namespace detail */
 
 
+/*!
+ * \brief  Snapshot of the usage of a MemPool, see MemPool::statistics.
+ *
+ * Used bytes count whole blocks taken from the arenas, including blocks
+ * held free by thread caches, so they track the memory the pool needs
+ * rather than the bytes requested.
+ */
+struct MemPoolStatistics {
+  static constexpr size_t num_size_bins = detail::num_size_bins;
+
+  size_t num_arenas = 0;
+  //! bytes allocated for arenas
+  size_t arena_bytes = 0;
+  //! bytes in blocks taken from the arenas
+  size_t used_bytes = 0;
+  //! high-water mark of used_bytes
+  size_t peak_used_bytes = 0;
+  //! bytes in free blocks held by thread caches, included in used_bytes
+  size_t thread_cached_bytes = 0;
+  //! bytes in free blocks of the arenas
+  size_t free_bytes = 0;
+  size_t largest_free_block = 0;
+
+  size_t num_mallocs = 0;
+  size_t num_frees = 0;
+  //! number of times the pool grew by allocating an arena
+  size_t num_arena_mallocs = 0;
+  //! counts of malloc calls by size, bin 0 holds 0 bytes and bin b holds
+  //! sizes in [2^(b-1), 2^b)
+  size_t malloc_sizes[num_size_bins] = {};
+
+  //! bytes in blocks handed out by malloc and not yet freed
+  size_t in_use_bytes() const { return used_bytes - thread_cached_bytes; }
+
+  //! 0 when the free bytes form one block, approaching 1 as they scatter
+  double fragmentation() const
+  {
+    return (free_bytes == 0) ? 0.0
+                             : 1.0 - static_cast<double>(largest_free_block) /
+                                         static_cast<double>(free_bytes);
+  }
+
+  //! print the statistics, with one line per non-empty size bin
+  void print(FILE* file, const char* name) const
+  {
+    fprintf(file,
+            "%s: %zu arenas of %zu bytes total, %zu bytes used (peak %zu, "
+            "%zu cached by threads), %zu bytes free (largest block %zu, "
+            "fragmentation %.3f)\n",
+            name,
+            num_arenas,
+            arena_bytes,
+            used_bytes,
+            peak_used_bytes,
+            thread_cached_bytes,
+            free_bytes,
+            largest_free_block,
+            fragmentation());
+    fprintf(file,
+            "%s: %zu mallocs, %zu frees, %zu arena allocations\n",
+            name,
+            num_mallocs,
+            num_frees,
+            num_arena_mallocs);
+    for (size_t bin = 0; bin < num_size_bins; ++bin) {
+      if (malloc_sizes[bin] != 0) {
+        const size_t lower = (bin == 0) ? 0 : size_t(1) << (bin - 1);
+        fprintf(file,
+                "%s:   mallocs of %zu+ bytes: %zu\n",
+                name,
+                lower,
+                malloc_sizes[bin]);
+      }
+    }
+  }
+};
+
+
+/*!
+ * \brief  Give the blocks cached by the calling thread back to every pool
+ *         with thread caching enabled.
+ *
+ * RAJA calls this as each thread leaves an OpenMP parallel region so that
+ * blocks do not stay stranded in the caches of idle threads. The pools are
+ * found without a lock and each thread only takes the lock of its own
+ * cache, so the threads of a team do not wait for each other. A pool
+ * destroyed or disabling caching meanwhile waits for the flush to finish.
+ */
+inline void flush_thread_caches()
+{
+  detail::ThreadCacheRegistry::get().for_each(
+      [](detail::ThreadCachedPool* pool) { pool->flush_thread_cache(); });
+}
+
+/*!
+ * \brief  Calls flush_thread_caches when the calling thread leaves the
+ *         scope, declared in the body of the parallel regions RAJA opens.
+ */
+class ThreadCacheFlushScope
+{
+public:
+  ThreadCacheFlushScope() = default;
+
+  ThreadCacheFlushScope(const ThreadCacheFlushScope&) = delete;
+  ThreadCacheFlushScope& operator=(const ThreadCacheFlushScope&) = delete;
+
+  ~ThreadCacheFlushScope() { flush_thread_caches(); }
+};
+
+
 /*! \class MemPool
  ******************************************************************************
  *
@@ -251,6 +924,19 @@ private:
  * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
  * the used/free space.
  *
+ * Optionally, each thread may cache small blocks so that threads allocating
+ * scratch memory in parallel do not serialize on the lock of the pool, see
+ * thread_cache_size. Caches are refilled and drained in batches and each one
+ * holds at most thread_cache_size bytes of free blocks. Up to
+ * max_thread_caches threads get a cache, and blocks are only cached from
+ * the first max_cache_arenas arenas, other allocations use the pool lock.
+ *
+ * statistics() gives a snapshot of the usage of the pool. The statistics
+ * may be printed when the pool is destroyed, which for pools from
+ * getInstance is at exit, and each time the pool grows by an arena. Setting
+ * the environment variable RAJA_MEMPOOL_REPORT to a list containing "exit"
+ * and/or "growth" turns these reports on for every pool.
+ *
  * MemPool provides an example generic_allocator which can guide more
  *specialized
  * allocators. The following are some examples
@@ -283,7 +969,7 @@ private:
  ******************************************************************************
  */
 template <typename allocator_t>
-class MemPool
+class MemPool : public detail::ThreadCachedPool
 {
 public:
   using allocator_type = allocator_t;
@@ -296,9 +982,19 @@ public:
 
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
+  //! most threads that get a cache while caching is enabled
+  static constexpr size_t max_thread_caches = 256;
+
+  //! most arenas that thread caches take blocks from
+  static constexpr size_t max_cache_arenas = 64;
+
   MemPool()
       : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
   {
+    if (const char* env = std::getenv("RAJA_MEMPOOL_REPORT")) {
+      m_report_at_exit = std::strstr(env, "exit") != nullptr;
+      m_report_on_growth = std::strstr(env, "growth") != nullptr;
+    }
   }
 
   ~MemPool()
@@ -306,54 +1002,254 @@ public:
     // With static objects like MemPool, cudaErrorCudartUnloading is a possible
     // error with cudaFree
     // So no more cuda calls here
+    if (m_thread_cache_size.load(std::memory_order_relaxed) != 0) {
+      detail::ThreadCacheRegistry::get().remove(this);
+    }
+    if (m_report_at_exit) {
+      print_statistics();
+    }
   }
 
 
   void free_chunks()
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    clear_thread_caches();
+
+    lock_guard<mutex_type> lock(m_mutex);
 
+    m_num_cache_arenas.store(0, std::memory_order_release);
     while (!m_arenas.empty()) {
       void* allocation_ptr = m_arenas.front().get_allocation();
       m_alloc.free(allocation_ptr);
       m_arenas.pop_front();
     }
+    m_used_bytes = 0;
   }
 
   size_t arena_size()
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<mutex_type> lock(m_mutex);
 
     return m_default_arena_size;
   }
 
   size_t arena_size(size_t new_size)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
+    lock_guard<mutex_type> lock(m_mutex);
 
     size_t prev_size = m_default_arena_size;
     m_default_arena_size = new_size;
     return prev_size;
   }
 
+  //! get a snapshot of the usage of the pool
+  MemPoolStatistics statistics()
+  {
+    MemPoolStatistics stats;
+    {
+      lock_guard<std::mutex> caches_lock(m_caches_mutex);
+      for (size_t i = 0; i < m_num_caches.load(std::memory_order_relaxed);
+           ++i) {
+        detail::ThreadCache* cache = m_caches[i].get();
+        lock_guard<std::mutex> lock(cache->mutex());
+        stats.thread_cached_bytes += cache->held_bytes();
+        stats.num_mallocs += cache->num_mallocs();
+        stats.num_frees += cache->num_frees();
+        for (size_t bin = 0; bin < MemPoolStatistics::num_size_bins; ++bin) {
+          stats.malloc_sizes[bin] += cache->malloc_sizes(bin);
+        }
+      }
+    }
+
+    lock_guard<mutex_type> lock(m_mutex);
+
+    for (detail::MemoryArena& arena : m_arenas) {
+      ++stats.num_arenas;
+      stats.arena_bytes += arena.capacity();
+      stats.free_bytes += arena.free_bytes();
+      stats.largest_free_block =
+          std::max(stats.largest_free_block, arena.largest_free_block());
+    }
+    stats.used_bytes = m_used_bytes;
+    stats.peak_used_bytes = m_peak_used_bytes;
+    stats.num_mallocs += m_num_mallocs;
+    stats.num_frees += m_num_frees;
+    stats.num_arena_mallocs = m_num_arena_mallocs;
+    for (size_t bin = 0; bin < MemPoolStatistics::num_size_bins; ++bin) {
+      stats.malloc_sizes[bin] += m_malloc_sizes[bin];
+    }
+    return stats;
+  }
+
+  //! reset the counters and set the peak to the bytes used now
+  void reset_statistics()
+  {
+    {
+      lock_guard<std::mutex> caches_lock(m_caches_mutex);
+      for (size_t i = 0; i < m_num_caches.load(std::memory_order_relaxed);
+           ++i) {
+        lock_guard<std::mutex> lock(m_caches[i]->mutex());
+        m_caches[i]->reset_counts();
+      }
+    }
+
+    lock_guard<mutex_type> lock(m_mutex);
+
+    m_peak_used_bytes = m_used_bytes;
+    m_num_mallocs = 0;
+    m_num_frees = 0;
+    m_num_arena_mallocs = 0;
+    for (size_t bin = 0; bin < MemPoolStatistics::num_size_bins; ++bin) {
+      m_malloc_sizes[bin] = 0;
+    }
+  }
+
+  void print_statistics(FILE* file = stderr)
+  {
+    statistics().print(file, m_report_name);
+  }
+
+  //! name used when printing statistics, must outlive the pool
+  void report_name(const char* name) { m_report_name = name; }
+
+  //! print statistics when the pool is destroyed
+  void report_at_exit(bool report) { m_report_at_exit = report; }
+
+  //! print a line each time the pool allocates a new arena
+  void report_on_growth(bool report) { m_report_on_growth = report; }
+
+  //! bytes of free blocks each thread may cache, 0 if caching is disabled
+  size_t thread_cache_size()
+  {
+    return m_thread_cache_size.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   * \brief  Set the bytes of free blocks each thread may cache, 0 disables
+   *         thread caching. Allocations of up to
+   *         detail::ThreadCache::max_class_size bytes are cached.
+   *
+   * Returns the previous size. Disabling caching gives all cached blocks
+   * back and destroys the caches, so free no longer looks for caches, and
+   * no other thread may be using the pool at that time. Threads flushing
+   * their caches when leaving a parallel region are waited for, see
+   * flush_thread_caches. Blocks handed out by a cache stay valid and are
+   * freed to the arenas.
+   */
+  size_t thread_cache_size(size_t new_size)
+  {
+    size_t prev_size = m_thread_cache_size.exchange(new_size);
+    if (prev_size == 0 && new_size != 0) {
+      detail::ThreadCacheRegistry::get().add(this);
+    } else if (prev_size != 0 && new_size == 0) {
+      detail::ThreadCacheRegistry::get().remove(this);
+      drop_thread_caches();
+    }
+    return prev_size;
+  }
+
+  //! give the free blocks cached by the calling thread back to the pool
+  void flush_thread_cache() override
+  {
+    detail::ThreadCache* cache = thread_cache(false);
+    if (cache != nullptr) {
+      lock_guard<std::mutex> lock(cache->mutex());
+      trim_thread_cache(*cache, 0);
+    }
+  }
+
+  //! give the free blocks cached by every thread back to the pool
+  void flush_all_thread_caches()
+  {
+    lock_guard<std::mutex> caches_lock(m_caches_mutex);
+    for (size_t i = 0; i < m_num_caches.load(std::memory_order_relaxed); ++i) {
+      lock_guard<std::mutex> lock(m_caches[i]->mutex());
+      trim_thread_cache(*m_caches[i], 0);
+    }
+  }
+
   template <typename T>
   T* malloc(size_t nTs, size_t alignment = alignof(T))
   {
+    const size_t size = nTs * sizeof(T);
+
+    if (size <= detail::ThreadCache::max_class_size &&
+        alignment <= detail::ThreadCache::min_class_size &&
+        m_thread_cache_size.load(std::memory_order_relaxed) != 0) {
+      detail::ThreadCache* cache = thread_cache(true);
+      void* ptr = (cache != nullptr) ? cached_malloc(*cache, size) : nullptr;
+      if (ptr != nullptr) {
+        return static_cast<T*>(ptr);
+      }
+    }
+
+    lock_guard<mutex_type> lock(m_mutex);
+
+    ++m_num_mallocs;
+    ++m_malloc_sizes[detail::size_bin(size)];
+    return static_cast<T*>(arena_malloc(size, alignment));
+  }
+
+  void free(const void* cptr)
+  {
+    void* ptr = const_cast<void*>(cptr);
+
+    if (m_num_caches.load(std::memory_order_acquire) != 0 &&
+        cached_free(ptr)) {
+      return;
+    }
+
+    lock_guard<mutex_type> lock(m_mutex);
+
+    ++m_num_frees;
+    arena_free(ptr);
+  }
+
+private:
+  using arena_container_type = std::list<detail::MemoryArena>;
+
+  // always locked, even without a threading back-end the pools are shared
+  // by any user threads, for example through the host scratch pool that
+  // sequential sorts use
 #if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
+  using mutex_type = omp::mutex;
+#else
+  using mutex_type = std::mutex;
 #endif
 
-    const size_t size = nTs * sizeof(T);
+  /*!
+   * \brief  Thread local lookup from pool cache keys to the caches of the
+   *         calling thread.
+   *
+   * One slot per pool the thread allocates from with caching enabled, 8
+   * covers the host and device pools a thread normally uses. A thread using
+   * more pools finds its cache in the others by scanning their caches,
+   * which takes no lock. Slots are replaced round robin.
+   */
+  struct thread_cache_slots {
+    static constexpr size_t num_slots = 8;
+    unsigned long long keys[num_slots] = {};
+    detail::ThreadCache* caches[num_slots] = {};
+    size_t next = 0;
+  };
+
+  //! arena tag of a block owned by the cache at index with size class cls
+  static uint32_t cache_tag(size_t index, size_t cls)
+  {
+    return static_cast<uint32_t>(((index + 1) << 8) | cls);
+  }
+
+  static size_t tag_cache_index(uint32_t tag) { return (tag >> 8) - 1; }
+
+  static size_t tag_class(uint32_t tag) { return tag & 0xff; }
+
+  // must hold m_mutex
+  void* arena_malloc(size_t size, size_t alignment)
+  {
     void* ptr = nullptr;
     arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
+    arena_container_type::iterator iter = m_arenas.begin();
+    for (; iter != end; ++iter) {
       ptr = iter->get(size, alignment);
       if (ptr != nullptr) {
         break;
@@ -362,28 +1258,51 @@ public:
 
     if (ptr == nullptr) {
       const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
+          std::max(detail::MemoryArena::required_capacity(size, alignment),
+                   m_default_arena_size);
       void* arena_ptr = m_alloc.malloc(alloc_size);
       if (arena_ptr != nullptr) {
         m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
+        ++m_num_arena_mallocs;
+        const size_t num_cache_arenas =
+            m_num_cache_arenas.load(std::memory_order_relaxed);
+        if (num_cache_arenas < max_cache_arenas) {
+          m_cache_arenas[num_cache_arenas] = &m_arenas.front();
+          m_num_cache_arenas.store(num_cache_arenas + 1,
+                                   std::memory_order_release);
+        }
+        iter = m_arenas.begin();
+        ptr = iter->get(size, alignment);
+        if (m_report_on_growth) {
+          fprintf(stderr,
+                  "%s: allocated arena %zu of %zu bytes for a request of "
+                  "%zu bytes, %zu bytes used\n",
+                  m_report_name,
+                  m_arenas.size(),
+                  alloc_size,
+                  size,
+                  m_used_bytes);
+        }
       }
     }
 
-    return static_cast<T*>(ptr);
+    if (ptr != nullptr) {
+      m_used_bytes += iter->block_size(ptr);
+      m_peak_used_bytes = std::max(m_peak_used_bytes, m_used_bytes);
+    }
+
+    return ptr;
   }
 
-  void free(const void* cptr)
+  // must hold m_mutex
+  void arena_free(void* ptr)
   {
-#if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
-#endif
-
-    void* ptr = const_cast<void*>(cptr);
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
+      const size_t used_bytes = iter->used_bytes();
       if (iter->give(ptr)) {
+        m_used_bytes -= used_bytes - iter->used_bytes();
         ptr = nullptr;
         break;
       }
@@ -393,16 +1312,248 @@ public:
     }
   }
 
-private:
-  using arena_container_type = std::list<detail::MemoryArena>;
+  /*!
+   * \brief  Find the cache of the calling thread, creating it if asked to.
+   *
+   * Returns nullptr if the thread has no cache, or needs one and
+   * max_thread_caches threads have one already. Only creating a cache takes
+   * a lock.
+   */
+  detail::ThreadCache* thread_cache(bool create)
+  {
+    static thread_local thread_cache_slots slots;
+    const unsigned long long key =
+        m_cache_key.load(std::memory_order_acquire);
+    for (size_t i = 0; i < thread_cache_slots::num_slots; ++i) {
+      if (slots.keys[i] == key) {
+        return slots.caches[i];
+      }
+    }
 
-#if defined(RAJA_ENABLE_OPENMP)
-  omp::mutex m_mutex;
-#endif
+    // caches are only added while caching is enabled and only this thread
+    // adds its own, so the caches may be scanned without a lock
+    const std::thread::id this_thread = std::this_thread::get_id();
+    detail::ThreadCache* cache = nullptr;
+    const size_t num_caches = m_num_caches.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num_caches; ++i) {
+      if (m_caches[i]->owner() == this_thread) {
+        cache = m_caches[i].get();
+        break;
+      }
+    }
+    if (cache == nullptr) {
+      if (!create) {
+        return nullptr;
+      }
+      lock_guard<std::mutex> caches_lock(m_caches_mutex);
+      const size_t index = m_num_caches.load(std::memory_order_relaxed);
+      if (index == max_thread_caches) {
+        return nullptr;
+      }
+      m_caches[index].reset(new detail::ThreadCache(this_thread, index));
+      cache = m_caches[index].get();
+      m_num_caches.store(index + 1, std::memory_order_release);
+    }
+
+    slots.keys[slots.next] = key;
+    slots.caches[slots.next] = cache;
+    slots.next = (slots.next + 1) % thread_cache_slots::num_slots;
+    return cache;
+  }
+
+  /*!
+   * \brief  Find the arena holding ptr among those thread caches take
+   *         blocks from.
+   *
+   * These arenas are only added while the pool is in use and only removed
+   * by free_chunks, so they may be read without a lock.
+   */
+  detail::MemoryArena* cache_arena(const void* ptr) const
+  {
+    const size_t num_arenas = m_num_cache_arenas.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num_arenas; ++i) {
+      if (m_cache_arenas[i]->contains(ptr)) {
+        return m_cache_arenas[i];
+      }
+    }
+    return nullptr;
+  }
+
+  void* cached_malloc(detail::ThreadCache& cache, size_t size)
+  {
+    lock_guard<std::mutex> lock(cache.mutex());
+
+    const size_t cls = detail::ThreadCache::size_class(size);
+    void* ptr = cache.pop(cls);
+    if (ptr == nullptr) {
+      lock_guard<mutex_type> pool_lock(m_mutex);
+      const size_t block_size = detail::ThreadCache::class_size(cls);
+      for (size_t b = 0; b < detail::ThreadCache::batch_size &&
+                         (b == 0 || cache.held_bytes() + block_size <=
+                                        m_thread_cache_size.load(
+                                            std::memory_order_relaxed));
+           ++b) {
+        void* block = arena_malloc(block_size,
+                                   detail::ThreadCache::min_class_size);
+        if (block == nullptr) {
+          break;
+        }
+        detail::MemoryArena* arena = cache_arena(block);
+        if (arena == nullptr) {
+          arena_free(block);
+          break;
+        }
+        arena->set_owner(block, cache_tag(cache.index(), cls));
+        if (ptr == nullptr) {
+          ptr = block;
+        } else {
+          cache.push(block, cls);
+        }
+      }
+    }
+    if (ptr != nullptr) {
+      cache.count_malloc(size);
+    }
+    return ptr;
+  }
+
+  /*!
+   * \brief  Give ptr to the cache that owns it, if any.
+   *
+   * The owner is read from the arena tag of the block, so only the lock of
+   * the owning cache is taken. The tag decides alone, the size of the block
+   * does not, as arenas with a coarse granularity round cached blocks up
+   * past the largest size class.
+   */
+  bool cached_free(void* ptr)
+  {
+    detail::MemoryArena* arena = cache_arena(ptr);
+    if (arena == nullptr) {
+      return false;
+    }
+    const uint32_t tag = arena->owner(ptr);
+    if (tag == 0) {
+      return false;
+    }
+    cached_free(*m_caches[tag_cache_index(tag)], ptr, tag_class(tag));
+    return true;
+  }
+
+  void cached_free(detail::ThreadCache& cache, void* ptr, size_t cls)
+  {
+    lock_guard<std::mutex> lock(cache.mutex());
+
+    cache.count_free();
+    if (cache.num_free(cls) == detail::ThreadCache::class_capacity) {
+      trim_thread_class(cache, cls, detail::ThreadCache::class_capacity / 2);
+    }
+    cache.push(ptr, cls);
+
+    const size_t limit = m_thread_cache_size.load(std::memory_order_relaxed);
+    if (cache.held_bytes() > limit) {
+      trim_thread_cache(cache, limit / 2);
+    }
+  }
+
+  // must hold the cache lock
+  void trim_thread_class(detail::ThreadCache& cache,
+                         size_t cls,
+                         size_t num_keep)
+  {
+    lock_guard<mutex_type> pool_lock(m_mutex);
+    while (cache.num_free(cls) > num_keep) {
+      arena_free(cache.pop(cls));
+    }
+  }
+
+  // must hold the cache lock, gives back the largest blocks first
+  void trim_thread_cache(detail::ThreadCache& cache, size_t held_bytes)
+  {
+    if (cache.held_bytes() <= held_bytes) {
+      return;
+    }
+    lock_guard<mutex_type> pool_lock(m_mutex);
+    for (size_t cls = detail::ThreadCache::num_classes; cls-- > 0;) {
+      while (cache.held_bytes() > held_bytes && cache.num_free(cls) > 0) {
+        arena_free(cache.pop(cls));
+      }
+    }
+  }
+
+  //! forget all cached blocks, used when the arenas are freed
+  void clear_thread_caches()
+  {
+    lock_guard<std::mutex> caches_lock(m_caches_mutex);
+    for (size_t i = 0; i < m_num_caches.load(std::memory_order_relaxed); ++i) {
+      lock_guard<std::mutex> lock(m_caches[i]->mutex());
+      m_caches[i]->clear();
+    }
+  }
+
+  /*!
+   * \brief  Give the free blocks of every cache back to the arenas, untag
+   *         the blocks the caches handed out and destroy the caches.
+   *
+   * Used when caching is disabled. Changing the cache key makes the thread
+   * local slots of every thread miss, so no thread finds a destroyed cache.
+   * The handed out blocks are untagged by walking the arenas, which only
+   * visits blocks that exist now, never pointers that were freed already.
+   */
+  void drop_thread_caches()
+  {
+    lock_guard<std::mutex> caches_lock(m_caches_mutex);
+    const size_t num_caches = m_num_caches.load(std::memory_order_relaxed);
+    m_num_caches.store(0, std::memory_order_release);
+    m_cache_key.store(detail::next_pool_id(), std::memory_order_release);
+
+    for (size_t i = 0; i < num_caches; ++i) {
+      detail::ThreadCache& cache = *m_caches[i];
+      {
+        lock_guard<std::mutex> lock(cache.mutex());
+        trim_thread_cache(cache, 0);
+        lock_guard<mutex_type> pool_lock(m_mutex);
+        // keep the counts of the cache in the statistics of the pool
+        m_num_mallocs += cache.num_mallocs();
+        m_num_frees += cache.num_frees();
+        for (size_t bin = 0; bin < MemPoolStatistics::num_size_bins; ++bin) {
+          m_malloc_sizes[bin] += cache.malloc_sizes(bin);
+        }
+      }
+      m_caches[i].reset();
+    }
+
+    lock_guard<mutex_type> pool_lock(m_mutex);
+    for (detail::MemoryArena& arena : m_arenas) {
+      arena.clear_owners();
+    }
+  }
+
+  mutex_type m_mutex;
 
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+
+  const char* m_report_name = "RAJA::basic_mempool::MemPool";
+  bool m_report_at_exit = false;
+  bool m_report_on_growth = false;
+
+  size_t m_used_bytes = 0;
+  size_t m_peak_used_bytes = 0;
+  size_t m_num_mallocs = 0;
+  size_t m_num_frees = 0;
+  size_t m_num_arena_mallocs = 0;
+  size_t m_malloc_sizes[MemPoolStatistics::num_size_bins] = {};
+
+  // key of the thread local slots, replaced when the caches are destroyed
+  std::atomic<unsigned long long> m_cache_key{detail::next_pool_id()};
+  std::atomic<size_t> m_thread_cache_size{0};
+  std::atomic<size_t> m_num_caches{0};
+  std::mutex m_caches_mutex;
+  std::unique_ptr<detail::ThreadCache> m_caches[max_thread_caches];
+
+  std::atomic<size_t> m_num_cache_arenas{0};
+  detail::MemoryArena* m_cache_arenas[max_cache_arenas] = {};
 };
 
 //! example allocator for basic_mempool using malloc/free
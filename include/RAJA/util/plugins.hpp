@@ -32,6 +32,9 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+  if (!p.hooks_active) {
+    return;
+  }
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -44,6 +47,9 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+  if (!p.hooks_active) {
+    return;
+  }
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -56,18 +62,26 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+  if (!p.hooks_active) {
+    return;
+  }
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
   {
     (*plugin).get()->preLaunch(p);
   }
+  detail::CurrentPluginContext::push(p);
 }
 
 RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+  if (!p.hooks_active) {
+    return;
+  }
+  detail::CurrentPluginContext::pop(p);
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -76,6 +90,85 @@ callPostLaunchPlugins(const PluginContext& p)
   }
 }
 
+RAJA_INLINE
+void
+callPreThreadLaunchPlugins(const PluginContext& p)
+{
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->preThreadLaunch(p);
+  }
+}
+
+RAJA_INLINE
+void
+callPostThreadLaunchPlugins(const PluginContext& p)
+{
+  for (auto plugin = PluginRegistry::begin();
+      plugin != PluginRegistry::end();
+      ++plugin)
+  {
+    (*plugin).get()->postThreadLaunch(p);
+  }
+}
+
+//! context of the kernel the calling thread runs, nullptr if none or if
+//! plugins are not called for it. The thread local is only read while a
+//! plugin is active.
+RAJA_INLINE
+const PluginContext*
+current_plugin_context()
+{
+  if (!plugins_active()) {
+    return nullptr;
+  }
+  return detail::CurrentPluginContext::get();
+}
+
+/*!
+ * Calls the thread hooks of the plugins on a thread of a host parallel
+ * region that runs part of the kernel with context p, unless the thread is
+ * the one that launched the kernel. p is read with current_plugin_context()
+ * on the launching thread before the region starts. While the scope lives
+ * p is the current context of the thread.
+ */
+class PluginThreadScope
+{
+public:
+  explicit PluginThreadScope(const PluginContext* p)
+    : m_context(p), m_enclosing(nullptr)
+  {
+    if (m_context == nullptr) {
+      return;
+    }
+    m_enclosing = detail::CurrentPluginContext::get();
+    if (m_context == m_enclosing) {
+      m_context = nullptr;
+      return;
+    }
+    detail::CurrentPluginContext::get() = m_context;
+    callPreThreadLaunchPlugins(*m_context);
+  }
+
+  PluginThreadScope(const PluginThreadScope&) = delete;
+  PluginThreadScope& operator=(const PluginThreadScope&) = delete;
+
+  ~PluginThreadScope()
+  {
+    if (m_context == nullptr) {
+      return;
+    }
+    callPostThreadLaunchPlugins(*m_context);
+    detail::CurrentPluginContext::get() = m_enclosing;
+  }
+
+private:
+  const PluginContext* m_context;
+  const PluginContext* m_enclosing;
+};
+
 RAJA_INLINE
 void
 callInitPlugins(const PluginOptions p)
@@ -20,8 +20,14 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -29,6 +35,10 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/Operators.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 namespace RAJA
 {
 
@@ -438,9 +448,126 @@ intro_sort(Iter begin,
   detail::intro_sort_depth(begin, end, comp, max_depth);
 }
 
+/*!
+    \brief reverse given range inplace using O(N) swaps
+*/
+template <typename Iter>
+RAJA_INLINE
+void
+reverse(Iter first,
+        Iter last)
+{
+  using ::RAJA::safe_iter_swap;
+
+  while ( last - first > 1 )
+  {
+    --last;
+    safe_iter_swap( first, last );
+    ++first;
+  }
+}
+
+/*!
+    \brief rotate given range so middle becomes the first element using O(N)
+    swaps and return the new position of first
+*/
+template <typename Iter>
+RAJA_INLINE
+Iter
+rotate(Iter first,
+       Iter middle,
+       Iter last)
+{
+  detail::reverse( first, middle );
+  detail::reverse( middle, last );
+  detail::reverse( first, last );
+
+  return first + (last - middle);
+}
+
 /*!
     \brief merge a range with midpoint using comparison function
-    with local range/2 copy
+    without extra memory using O(N*lg(N)) comparisons and swaps
+*/
+template <typename Iter, typename Compare>
+void
+merge_without_buffer(Iter first,
+                     Iter middle,
+                     Iter last,
+                     Compare comp)
+{
+  using ::RAJA::safe_iter_swap;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  const diff_type len1 = middle - first;
+  const diff_type len2 = last - middle;
+
+  if ( len1 == 0 || len2 == 0 )
+  {
+    return;
+  }
+
+  if ( len1 + len2 == 2 )
+  {
+    if ( comp(*middle, *first) )
+    {
+      safe_iter_swap( first, middle );
+    }
+    return;
+  }
+
+  // split the longer side in half and find the matching split of the other
+  Iter first_cut = first;
+  Iter second_cut = middle;
+  if ( len1 > len2 )
+  {
+    first_cut += len1 / 2;
+    // first element of second half not less than *first_cut
+    diff_type count = len2;
+    while ( count > 0 )
+    {
+      const diff_type step = count / 2;
+      if ( comp(second_cut[step], *first_cut) )
+      {
+        second_cut += step + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+  }
+  else
+  {
+    second_cut += len2 / 2;
+    // first element of first half greater than *second_cut
+    diff_type count = len1;
+    while ( count > 0 )
+    {
+      const diff_type step = count / 2;
+      if ( !comp(*second_cut, first_cut[step]) )
+      {
+        first_cut += step + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+  }
+
+  Iter new_middle = detail::rotate( first_cut, middle, second_cut );
+
+  detail::merge_without_buffer( first, first_cut, new_middle, comp );
+  detail::merge_without_buffer( new_middle, second_cut, last, comp );
+}
+
+/*!
+    \brief merge a range with midpoint using comparison function
+    with local range/2 copy in copyarr, which must have storage for
+    (middle - first) objects, or without extra memory if copyarr is nullptr
 */
 template <typename Iter, typename Compare>
 void
@@ -448,7 +575,8 @@ RAJA_INLINE
 inplace_merge(  Iter first,
                 Iter middle,
                 Iter last,
-                Compare comp  )
+                Compare comp,
+                RAJA::detail::IterVal<Iter>* copyarr )
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
   using value_type = RAJA::detail::IterVal<Iter>;
@@ -467,24 +595,22 @@ inplace_merge(  Iter first,
     return;
   }
 
-  // Manage the lifetime of the buffer and objects constructed in the buffer
-  using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
-  buf_deleter_type buf_deleter;
+  if ( copyarr == nullptr )
+  {
+    detail::merge_without_buffer( first, middle, last, comp );
+    return;
+  }
 
-  std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
-      RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, copylen * sizeof(value_type) ),
-      buf_deleter);
+  // Manage the lifetime of the objects constructed in the buffer
+  using buf_destroyer_type = DestroyType<value_type, diff_type>;
+  buf_destroyer_type buf_destroyer;
 
-  value_type* copyarr = copy_buf.get();
-
-  // check memory allocation worked
-  if (copyarr == nullptr) {
-    RAJA_ABORT_OR_THROW( "inplace_merge temporary memory allocation failed" );
-  }
+  std::unique_ptr<value_type, buf_destroyer_type&> copy_buf(
+      copyarr, buf_destroyer);
 
   // move construct input into buffer storage
-  // use buf_deleter.size as index to keep track of objects constructed
-  for ( diff_type& cc = buf_deleter.size; cc < copylen; ++cc )
+  // use buf_destroyer.size as index to keep track of objects constructed
+  for ( diff_type& cc = buf_destroyer.size; cc < copylen; ++cc )
   {
     new(&copyarr[cc]) value_type(std::move(first[cc]));
   }
@@ -517,6 +643,183 @@ inplace_merge(  Iter first,
   return;
 }
 
+/*!
+    \brief merge a range with midpoint using comparison function
+    with local range/2 copy from allocate_host_scratch, merging without
+    extra memory if the copy can not be allocated
+*/
+template <typename Iter, typename Compare>
+void
+RAJA_INLINE
+inplace_merge(  Iter first,
+                Iter middle,
+                Iter last,
+                Compare comp  )
+{
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  if ( first == middle || middle == last || !comp(*middle, *(middle-1)) )
+  {
+    // already sorted
+    return;
+  }
+
+  host_scratch_ptr<value_type> copy_buf =
+      allocate_host_scratch<value_type>(middle - first);
+
+  detail::inplace_merge( first, middle, last, comp, copy_buf.get() );
+}
+
+/*!
+    \brief find the merge path split of output position d
+
+    Returns the number of elements taken from [a, a + a_len) among the
+    first d outputs of a stable merge of [a, a + a_len) and
+    [b, b + b_len), where ties take from a first.
+*/
+template <typename Iter1, typename Iter2, typename Compare>
+RAJA_INLINE
+RAJA::detail::IterDiff<Iter1>
+merge_path_split( Iter1 a,
+                  RAJA::detail::IterDiff<Iter1> a_len,
+                  Iter2 b,
+                  RAJA::detail::IterDiff<Iter1> b_len,
+                  RAJA::detail::IterDiff<Iter1> d,
+                  Compare comp )
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type lo = (d > b_len) ? d - b_len : 0;
+  diff_type hi = (d < a_len) ? d : a_len;
+
+  while ( lo < hi )
+  {
+    const diff_type i = lo + (hi - lo) / 2;
+    const diff_type j = d - i;
+    // a[i] precedes b[j-1] in the merge, so more of a is needed
+    if ( j > 0 && !comp(b[j-1], a[i]) )
+    {
+      lo = i + 1;
+    }
+    else
+    {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+    \brief stable merge of [a, a_end) and [b, b_end) into out, moving
+*/
+template <typename Iter1, typename Iter2, typename OutIter, typename Compare>
+RAJA_INLINE
+void
+merge_move( Iter1 a,
+            Iter1 a_end,
+            Iter2 b,
+            Iter2 b_end,
+            OutIter out,
+            Compare comp )
+{
+  while ( a != a_end && b != b_end )
+  {
+    if ( comp(*b, *a) )
+    {
+      *out = std::move(*b);
+      ++b;
+    }
+    else
+    {
+      *out = std::move(*a);
+      ++a;
+    }
+    ++out;
+  }
+  out = std::move( a, a_end, out );
+  std::move( b, b_end, out );
+}
+
+/*!
+    \brief inputs of one output block of a merge level, see
+    merge_block_split
+*/
+template <typename DiffType>
+struct MergeBlockSplit
+{
+  DiffType a_begin;
+  DiffType a_end;
+  DiffType b_begin;
+  DiffType b_end;
+  DiffType out_begin;
+};
+
+/*!
+    \brief find the inputs of output block `block` of a merge level
+
+    A range of n objects is split into num_blocks blocks with firstIndex,
+    and blocks [pair_begin, pair_begin + width) and
+    [pair_begin + width, pair_begin + 2*width) hold sorted runs that merge
+    into the same blocks of the output. The output block lines up with
+    `block`, and a merge path search finds where its inputs start and end,
+    so every block of a level can be merged independently with
+    merge_block_move.
+*/
+template <typename Iter, typename DiffType, typename Compare>
+RAJA_INLINE
+MergeBlockSplit<DiffType>
+merge_block_split( Iter src,
+                   DiffType n,
+                   DiffType num_blocks,
+                   DiffType block,
+                   DiffType width,
+                   Compare comp )
+{
+  using diff_type = DiffType;
+
+  const diff_type pair_begin = (block / (2*width)) * (2*width);
+
+  const diff_type i_begin  = firstIndex(n, num_blocks, pair_begin);
+  const diff_type i_middle = firstIndex(n, num_blocks, std::min(pair_begin + width,   num_blocks));
+  const diff_type i_end    = firstIndex(n, num_blocks, std::min(pair_begin + 2*width, num_blocks));
+
+  const diff_type o_begin = firstIndex(n, num_blocks, block);
+  const diff_type o_end   = firstIndex(n, num_blocks, block + 1);
+
+  const diff_type a_len = i_middle - i_begin;
+  const diff_type b_len = i_end - i_middle;
+
+  const diff_type a_first = merge_path_split(src + i_begin, a_len, src + i_middle, b_len, o_begin - i_begin, comp);
+  const diff_type a_last  = merge_path_split(src + i_begin, a_len, src + i_middle, b_len, o_end   - i_begin, comp);
+
+  const diff_type b_first = (o_begin - i_begin) - a_first;
+  const diff_type b_last  = (o_end   - i_begin) - a_last;
+
+  return MergeBlockSplit<diff_type>{ i_begin + a_first, i_begin + a_last,
+                                     i_middle + b_first, i_middle + b_last,
+                                     o_begin };
+}
+
+/*!
+    \brief merge the inputs of one output block found by merge_block_split
+    from src into dst
+
+    Moving out of src invalidates the searches of other blocks, so all
+    blocks of a level must be split before any block is moved.
+*/
+template <typename SrcIter, typename DstIter, typename DiffType, typename Compare>
+RAJA_INLINE
+void
+merge_block_move( SrcIter src,
+                  DstIter dst,
+                  MergeBlockSplit<DiffType> const& split,
+                  Compare comp )
+{
+  merge_move( src + split.a_begin, src + split.a_end,
+              src + split.b_begin, src + split.b_end,
+              dst + split.out_begin, comp );
+}
+
 /*!
     \brief merge given two ranges using comparison function
     while copies are outside, somewhat follows STL API
@@ -582,14 +885,17 @@ merge_like_std( Iter1 first1,
 
 /*!
     \brief stable merge sort given range inplace using comparison function
-    and using O(N*lg(N)) comparisons and O(N) memory
+    and using O(N*lg(N)) comparisons and O(N) memory in copyarr, which must
+    have storage for (end - begin) objects, or using O(N*lg(N)^2)
+    comparisons and O(1) memory if copyarr is nullptr
 */
 template <typename Iter, typename Compare>
 RAJA_INLINE
 void
 merge_sort(Iter begin,
            Iter end,
-           Compare comp)
+           Compare comp,
+           RAJA::detail::IterVal<Iter>* copyarr)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
   using value_type = RAJA::detail::IterVal<Iter>;
@@ -615,26 +921,32 @@ merge_sort(Iter begin,
       detail::insertion_sort( begin + start, begin + start + lastchunk, comp );
     }
 
-    // merge using extra storage
-
-    // Manage the lifetime of the buffer and objects constructed in the buffer
-    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
-    buf_deleter_type buf_deleter;
+    if ( copyarr == nullptr )
+    {
+      // merge without extra storage
+      for ( diff_type midpoint = 16; midpoint < len; midpoint *= 2 )  // O(log n) loop
+      {
+        for ( diff_type start = 0; start + midpoint < len; start += midpoint * 2 )
+        {
+          diff_type finish = minlam( start + midpoint * 2, len );
+          detail::merge_without_buffer( begin + start, begin + start + midpoint, begin + finish, comp );
+        }
+      }
+      return;
+    }
 
-    std::unique_ptr<value_type, buf_deleter_type&> copy_buf(
-        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, len * sizeof(value_type) ),
-        buf_deleter);
+    // merge using extra storage
 
-    value_type* copyarr = copy_buf.get();
+    // Manage the lifetime of the objects constructed in the buffer
+    using buf_destroyer_type = DestroyType<value_type, diff_type>;
+    buf_destroyer_type buf_destroyer;
 
-    // check memory allocation worked
-    if (copyarr == nullptr) {
-      RAJA_ABORT_OR_THROW( "merge_sort temporary memory allocation failed" );
-    }
+    std::unique_ptr<value_type, buf_destroyer_type&> copy_buf(
+        copyarr, buf_destroyer);
 
     // move construct input into buffer storage
-    // use buf_deleter.size as index to keep track of objects constructed
-    for ( diff_type& cc = buf_deleter.size; cc < len; ++cc )
+    // use buf_destroyer.size as index to keep track of objects constructed
+    for ( diff_type& cc = buf_destroyer.size; cc < len; ++cc )
     {
       new(&copyarr[cc]) value_type(std::move(begin[cc]));
     }
@@ -684,13 +996,392 @@ merge_sort(Iter begin,
       std::move( copyarr, copyarr + len, begin );
     }
   }
-  //else
-  //{
-      // Possible TBD: in-place mergesort
-      // Would shift (like insertion sort) when performing merge.
-      // PRO - Can use on GPU, O(1) storage required.
-      // CON - Shifting would cause slowdown O(n^2 log n).
-  //}
+}
+
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and O(N) memory from
+    allocate_host_scratch, sorting without extra memory if it can not be
+    allocated
+*/
+template <typename Iter, typename Compare>
+RAJA_INLINE
+void
+merge_sort(Iter begin,
+           Iter end,
+           Compare comp)
+{
+  using value_type = RAJA::detail::IterVal<Iter>;
+
+  static constexpr RAJA::detail::IterDiff<Iter> insertion_sort_cutoff = 16;
+  if ( end - begin <= insertion_sort_cutoff )
+  {
+    detail::merge_sort( begin, end, comp, static_cast<value_type*>(nullptr) );
+    return;
+  }
+
+  host_scratch_ptr<value_type> copy_buf =
+      allocate_host_scratch<value_type>(end - begin);
+
+  detail::merge_sort( begin, end, comp, copy_buf.get() );
+}
+
+/*!
+    \brief unsigned integer type of the given size in bytes, used to hold
+    the bits of radix sort keys
+*/
+template <size_t Size>
+struct radix_sort_uint
+{
+  using type = void;
+};
+///
+template <>
+struct radix_sort_uint<1>
+{
+  using type = std::uint8_t;
+};
+///
+template <>
+struct radix_sort_uint<2>
+{
+  using type = std::uint16_t;
+};
+///
+template <>
+struct radix_sort_uint<4>
+{
+  using type = std::uint32_t;
+};
+///
+template <>
+struct radix_sort_uint<8>
+{
+  using type = std::uint64_t;
+};
+
+/*!
+    \brief maps keys of type T to unsigned integers whose ascending order
+    matches the order of the keys under Compare
+
+    Only arithmetic keys of 1, 2, 4, or 8 bytes compared with
+    RAJA::operators::less or RAJA::operators::greater are supported,
+    floating point keys must be IEEE 754. Negative and positive zero map
+    to the same value, so stable sorts keep them in input order. With
+    less, NaN keys with the sign bit set come before all other keys and
+    NaN keys without it come after all other keys, and greater reverses
+    this. The comparison sorts leave the order of NaN keys unspecified.
+*/
+template <typename T, typename Compare>
+struct radix_sort_key
+{
+  using bits_type = typename radix_sort_uint<sizeof(T)>::type;
+
+  static constexpr bool descending =
+      std::is_same<Compare, operators::greater<T>>::value;
+
+  static constexpr bool valid =
+      !std::is_void<bits_type>::value &&
+      (std::is_integral<T>::value ||
+       (std::is_floating_point<T>::value &&
+        std::numeric_limits<T>::is_iec559)) &&
+      (std::is_same<Compare, operators::less<T>>::value || descending);
+
+  static constexpr int num_bits = sizeof(T) * CHAR_BIT;
+
+  RAJA_INLINE
+  static bits_type get(T key)
+  {
+    constexpr bits_type sign_bit = bits_type(1) << (num_bits - 1);
+
+    if (std::is_floating_point<T>::value && key == T(0)) {
+      key = T(0);
+    }
+
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(T));
+
+    if (std::is_floating_point<T>::value) {
+      bits = (bits & sign_bit) ? bits_type(~bits) : bits_type(bits | sign_bit);
+    } else if (std::is_signed<T>::value) {
+      bits = bits_type(bits ^ sign_bit);
+    }
+
+    return descending ? bits_type(~bits) : bits;
+  }
+};
+
+/*!
+    \brief number of bits sorted per radix sort pass
+*/
+constexpr int radix_sort_digit_bits() { return 8; }
+
+/*!
+    \brief number of buckets per radix sort pass
+*/
+constexpr int radix_sort_num_buckets() { return 1 << radix_sort_digit_bits(); }
+
+/*!
+    \brief ranges shorter than this are left to the comparison sorts
+*/
+constexpr int radix_sort_cutoff() { return 1024; }
+
+/*!
+    \brief true if [begin, end) may be sorted with Compare by radix sort
+*/
+template <typename Iter, typename Compare>
+struct is_radix_sortable
+    : std::integral_constant<bool,
+                             radix_sort_key<IterVal<Iter>, Compare>::valid> {
+};
+
+/*!
+    \brief get the radix sort digit of key starting at bit shift
+*/
+template <typename T, typename Compare>
+RAJA_INLINE
+unsigned
+radix_sort_digit(T const& key, int shift)
+{
+  return static_cast<unsigned>(
+      (radix_sort_key<T, Compare>::get(key) >> shift) &
+      (radix_sort_num_buckets() - 1));
+}
+
+/*!
+    \brief add the radix sort digits at bit shift of keys [begin, end) to
+    counts, which has radix_sort_num_buckets() entries
+*/
+template <typename Compare, typename KeyIter, typename Count>
+RAJA_INLINE
+void
+radix_sort_count(KeyIter begin,
+                 KeyIter end,
+                 int shift,
+                 Count* counts)
+{
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+
+  for (; begin != end; ++begin) {
+    ++counts[radix_sort_digit<key_type, Compare>(*begin, shift)];
+  }
+}
+
+/*!
+    \brief turn per bucket counts into exclusive offsets and return true if
+    a single bucket holds all total keys
+*/
+template <typename Count>
+RAJA_INLINE
+bool
+radix_sort_offsets(Count* counts, Count total)
+{
+  Count offset = 0;
+  bool one_bucket = false;
+  for (int b = 0; b < radix_sort_num_buckets(); ++b) {
+    const Count count = counts[b];
+    one_bucket = one_bucket || (count == total);
+    counts[b] = offset;
+    offset += count;
+  }
+  return one_bucket;
+}
+
+/*!
+    \brief stably move keys [keys, keys + n) into keys_out, bucketed by the
+    radix sort digit at bit shift, advancing offsets as keys are placed
+*/
+template <typename Compare, typename KeyIn, typename KeyOut, typename Count>
+RAJA_INLINE
+void
+radix_sort_scatter(KeyIn keys,
+                   Count n,
+                   KeyOut keys_out,
+                   int shift,
+                   Count* offsets)
+{
+  using key_type = RAJA::detail::IterVal<KeyIn>;
+
+  for (Count i = 0; i < n; ++i) {
+    const key_type key = keys[i];
+    keys_out[offsets[radix_sort_digit<key_type, Compare>(key, shift)]++] = key;
+  }
+}
+
+/*!
+    \brief stably move keys [keys, keys + n) and their values into
+    keys_out and vals_out, see radix_sort_scatter. If Construct, vals_out
+    is uninitialized storage and values are move constructed into it.
+*/
+template <bool Construct,
+          typename Compare,
+          typename KeyIn,
+          typename ValIn,
+          typename KeyOut,
+          typename ValOut,
+          typename Count>
+RAJA_INLINE
+void
+radix_sort_scatter_pairs(KeyIn keys,
+                         ValIn vals,
+                         Count n,
+                         KeyOut keys_out,
+                         ValOut vals_out,
+                         int shift,
+                         Count* offsets)
+{
+  using key_type = RAJA::detail::IterVal<KeyIn>;
+  using val_type = RAJA::detail::IterVal<ValIn>;
+
+  for (Count i = 0; i < n; ++i) {
+    const key_type key = keys[i];
+    const Count pos = offsets[radix_sort_digit<key_type, Compare>(key, shift)]++;
+    keys_out[pos] = key;
+    if (Construct) {
+      new (&vals_out[pos]) val_type(std::move(vals[i]));
+    } else {
+      vals_out[pos] = std::move(vals[i]);
+    }
+  }
+}
+
+/*!
+    \brief stable least significant digit radix sort of arithmetic keys
+    using O(N) time and O(N) memory
+
+    \return false without modifying the range if it is shorter than
+    radix_sort_cutoff() or scratch memory could not be allocated, so the
+    caller can fall back to a comparison sort
+*/
+template <typename KeyIter, typename Compare>
+bool
+radix_sort(KeyIter keys_begin,
+           KeyIter keys_end,
+           Compare)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+
+  const diff_type n = keys_end - keys_begin;
+  if (n < radix_sort_cutoff()) {
+    return false;
+  }
+
+  host_scratch_ptr<key_type> keys_buf =
+      allocate_host_scratch<key_type>(n);
+  if (keys_buf == nullptr) {
+    return false;
+  }
+
+  bool in_buf = false;
+  for (int shift = 0; shift < radix_sort_key<key_type, Compare>::num_bits;
+       shift += radix_sort_digit_bits()) {
+
+    diff_type counts[radix_sort_num_buckets()] = {};
+    if (in_buf) {
+      radix_sort_count<Compare>(keys_buf.get(), keys_buf.get() + n, shift, counts);
+    } else {
+      radix_sort_count<Compare>(keys_begin, keys_end, shift, counts);
+    }
+
+    // every key has the same digit, this pass would not move anything
+    if (radix_sort_offsets(counts, n)) {
+      continue;
+    }
+
+    if (in_buf) {
+      radix_sort_scatter<Compare>(keys_buf.get(), n, keys_begin, shift, counts);
+    } else {
+      radix_sort_scatter<Compare>(keys_begin, n, keys_buf.get(), shift, counts);
+    }
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+    std::copy(keys_buf.get(), keys_buf.get() + n, keys_begin);
+  }
+
+  return true;
+}
+
+/*!
+    \brief stable least significant digit radix sort of arithmetic keys
+    and their values using O(N) time and O(N) memory, see radix_sort
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+bool
+radix_sort_pairs(KeyIter keys_begin,
+                 KeyIter keys_end,
+                 ValIter vals_begin,
+                 Compare)
+{
+  using diff_type = RAJA::detail::IterDiff<KeyIter>;
+  using key_type = RAJA::detail::IterVal<KeyIter>;
+  using val_type = RAJA::detail::IterVal<ValIter>;
+
+  const diff_type n = keys_end - keys_begin;
+  if (n < radix_sort_cutoff()) {
+    return false;
+  }
+
+  host_scratch_ptr<key_type> keys_buf =
+      allocate_host_scratch<key_type>(n);
+  if (keys_buf == nullptr) {
+    return false;
+  }
+
+  host_scratch_ptr<val_type> vals_buf =
+      allocate_host_scratch<val_type>(n);
+  if (vals_buf == nullptr) {
+    return false;
+  }
+
+  // Manage the lifetime of the objects constructed in the buffer
+  using buf_destroyer_type = DestroyType<val_type, diff_type>;
+  buf_destroyer_type buf_destroyer;
+
+  std::unique_ptr<val_type, buf_destroyer_type&> vals_objs(
+      vals_buf.get(), buf_destroyer);
+
+  key_type* keys_tmp = keys_buf.get();
+  val_type* vals_tmp = vals_buf.get();
+
+  bool in_buf = false;
+  for (int shift = 0; shift < radix_sort_key<key_type, Compare>::num_bits;
+       shift += radix_sort_digit_bits()) {
+
+    diff_type counts[radix_sort_num_buckets()] = {};
+    if (in_buf) {
+      radix_sort_count<Compare>(keys_tmp, keys_tmp + n, shift, counts);
+    } else {
+      radix_sort_count<Compare>(keys_begin, keys_end, shift, counts);
+    }
+
+    // every key has the same digit, this pass would not move anything
+    if (radix_sort_offsets(counts, n)) {
+      continue;
+    }
+
+    if (in_buf) {
+      radix_sort_scatter_pairs<false, Compare>(
+          keys_tmp, vals_tmp, n, keys_begin, vals_begin, shift, counts);
+    } else if (buf_destroyer.size == 0) {
+      radix_sort_scatter_pairs<true, Compare>(
+          keys_begin, vals_begin, n, keys_tmp, vals_tmp, shift, counts);
+      buf_destroyer.size = n;
+    } else {
+      radix_sort_scatter_pairs<false, Compare>(
+          keys_begin, vals_begin, n, keys_tmp, vals_tmp, shift, counts);
+    }
+    in_buf = !in_buf;
+  }
+
+  if (in_buf) {
+    std::copy(keys_tmp, keys_tmp + n, keys_begin);
+    std::move(vals_tmp, vals_tmp + n, vals_begin);
+  }
+
+  return true;
 }
 
 }  // namespace detail
@@ -845,6 +1536,39 @@ merge_sort(Container&& c,
   }
 }
 
+/*!
+    \brief stable merge sort given range inplace using comparison function
+    and using O(N*lg(N)) comparisons and caller provided workspace with
+    storage for as many objects as the range holds, or using
+    O(N*lg(N)^2) comparisons and O(1) memory if workspace is nullptr
+*/
+template <typename Container,
+          typename Compare>
+RAJA_INLINE
+concepts::enable_if<type_traits::is_range<Container>>
+merge_sort(Container&& c,
+           Compare comp,
+           detail::ContainerVal<Container>* workspace)
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<Container>;
+  static_assert(type_traits::is_binary_function<Compare, bool, T, T>::value,
+                "Compare must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<Container>::value,
+                "Container must model RandomAccessRange");
+
+  auto begin_it = begin(c);
+  auto end_it   = end(c);
+
+  if (begin_it != end_it) {
+    auto next = begin_it;
+    if (++next != end_it) {
+      detail::merge_sort(begin_it, end_it, comp, workspace);
+    }
+  }
+}
+
 }  // namespace RAJA
 
 #endif
@@ -0,0 +1,278 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/AutoTuner.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::string make_key(const std::string& name, uint64_t list_id, int length_class)
+{
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "\t%016llx\t%d",
+                static_cast<unsigned long long>(list_id), length_class);
+  return name + buf;
+}
+
+//! create a file with a unique name next to filename for writing, its name
+//! is stored in tmp, returns nullptr if it could not be created
+FILE* open_temporary(const std::string& filename, std::string& tmp)
+{
+#if defined(_WIN32)
+  tmp = filename + "." + std::to_string(_getpid()) + ".tmp";
+  return std::fopen(tmp.c_str(), "w");
+#else
+  tmp = filename + ".XXXXXX";
+  const int fd = mkstemp(&tmp[0]);
+  if (fd < 0) {
+    return nullptr;
+  }
+  // mkstemp makes the file private to the user, give it the usual mode
+  fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  return fdopen(fd, "w");
+#endif
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace expt {
+
+AutoTuner& AutoTuner::getInstance()
+{
+  static AutoTuner tuner;
+  return tuner;
+}
+
+AutoTuner::AutoTuner()
+{
+  char* env = getenv("RAJA_AUTOTUNE_FILE");
+  if (env != nullptr) {
+    m_file = env;
+  }
+  env = getenv("RAJA_AUTOTUNE_TRIALS");
+  if (env != nullptr && std::atoi(env) > 0) {
+    m_trials = std::atoi(env);
+  }
+}
+
+int AutoTuner::trials(int num_trials)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const int old = m_trials;
+  m_trials = num_trials > 0 ? num_trials : 1;
+  return old;
+}
+
+int AutoTuner::trials()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_trials;
+}
+
+void AutoTuner::file(const std::string& filename)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_file = filename;
+  m_loaded = false;
+}
+
+std::string AutoTuner::file()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_file;
+}
+
+TunedKernel& AutoTuner::kernel(const char* name,
+                               uint64_t list_id,
+                               int num_policies,
+                               int length_class)
+{
+  const std::string key = make_key(name, list_id, length_class);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  load_locked();
+
+  auto found = m_kernels.find(key);
+  if (found != m_kernels.end()) {
+    return *found->second;
+  }
+
+  std::unique_ptr<TunedKernel> k(new TunedKernel);
+  k->key = key;
+  k->num_policies = num_policies;
+  k->best_seconds.assign(num_policies, std::numeric_limits<double>::max());
+  auto saved = m_saved.find(key);
+  if (saved != m_saved.end() && saved->second.num_policies == num_policies &&
+      saved->second.choice >= 0 && saved->second.choice < num_policies) {
+    k->choice.store(saved->second.choice, std::memory_order_release);
+  }
+  return *m_kernels.emplace(key, std::move(k)).first->second;
+}
+
+int AutoTuner::next_policy(TunedKernel& k)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const int choice = k.choice.load(std::memory_order_relaxed);
+  if (choice >= 0) {
+    return choice;
+  }
+  return k.num_timed++ % k.num_policies;
+}
+
+void AutoTuner::record(TunedKernel& k, int policy, double seconds)
+{
+  std::string filename;
+  std::string contents;
+  unsigned long long version = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (k.choice.load(std::memory_order_relaxed) >= 0) {
+      return;
+    }
+    if (seconds < k.best_seconds[policy]) {
+      k.best_seconds[policy] = seconds;
+    }
+    if (k.num_timed < m_trials * k.num_policies) {
+      return;
+    }
+
+    int best = 0;
+    for (int p = 1; p < k.num_policies; ++p) {
+      if (k.best_seconds[p] < k.best_seconds[best]) {
+        best = p;
+      }
+    }
+    k.choice.store(best, std::memory_order_release);
+    if (k.retired) {
+      return;
+    }
+    m_saved[k.key] = saved_choice{k.num_policies, best, k.best_seconds[best]};
+    if (m_file.empty()) {
+      return;
+    }
+    filename = m_file;
+    contents = format_locked();
+    version = ++m_saved_version;
+  }
+  save(filename, contents, version);
+}
+
+void AutoTuner::reset()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto& kernel : m_kernels) {
+    kernel.second->retired = true;
+    m_retired.push_back(std::move(kernel.second));
+  }
+  m_kernels.clear();
+  m_saved.clear();
+  m_loaded = false;
+  m_generation.fetch_add(1, std::memory_order_release);
+}
+
+void AutoTuner::load_locked()
+{
+  if (m_loaded) {
+    return;
+  }
+  m_loaded = true;
+  if (m_file.empty()) {
+    return;
+  }
+
+  // lines are: kernel name, policy list, length class, number of policies,
+  // chosen policy, and its time; the name may contain anything but newlines
+  std::ifstream in(m_file);
+  for (std::string line; std::getline(in, line);) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::string fields[5];
+    size_t end = line.size();
+    bool valid = true;
+    for (int f = 4; f >= 0 && valid; --f) {
+      const size_t tab = line.rfind('\t', end - 1);
+      valid = (tab != std::string::npos && tab > 0);
+      if (valid) {
+        fields[f] = line.substr(tab + 1, end - tab - 1);
+        end = tab;
+      }
+    }
+    if (!valid) {
+      continue;
+    }
+    const std::string name = line.substr(0, end);
+    const uint64_t list_id = std::strtoull(fields[0].c_str(), nullptr, 16);
+    const int length_class = std::atoi(fields[1].c_str());
+    m_saved[make_key(name, list_id, length_class)] =
+        saved_choice{std::atoi(fields[2].c_str()),
+                     std::atoi(fields[3].c_str()),
+                     std::atof(fields[4].c_str())};
+  }
+}
+
+std::string AutoTuner::format_locked() const
+{
+  std::string contents =
+      "# kernel\tpolicy list\tlength class\tpolicies\tchoice\tseconds\n";
+  for (const auto& saved : m_saved) {
+    char fields[64];
+    std::snprintf(fields, sizeof(fields), "\t%d\t%d\t%.6e\n",
+                  saved.second.num_policies, saved.second.choice,
+                  saved.second.seconds);
+    contents += saved.first;
+    contents += fields;
+  }
+  return contents;
+}
+
+void AutoTuner::save(const std::string& filename,
+                     const std::string& contents,
+                     unsigned long long version)
+{
+  std::lock_guard<std::mutex> lock(m_file_mutex);
+  if (version < m_written_version) {
+    // a newer set of choices was written meanwhile
+    return;
+  }
+  m_written_version = version;
+
+  // write a new file and move it over the old one, so a run that stops
+  // while saving does not leave a truncated file. The new file has a
+  // unique name, so processes sharing the file do not write the same one.
+  std::string tmp;
+  FILE* out = open_temporary(filename, tmp);
+  if (out == nullptr) {
+    printf("[AutoTuner]: could not write %s\n", tmp.c_str());
+    return;
+  }
+  const bool written =
+      std::fwrite(contents.data(), 1, contents.size(), out) == contents.size();
+  if (std::fclose(out) != 0 || !written) {
+    printf("[AutoTuner]: could not write %s\n", tmp.c_str());
+    std::remove(tmp.c_str());
+    return;
+  }
+  if (std::rename(tmp.c_str(), filename.c_str()) != 0) {
+    printf("[AutoTuner]: could not write %s\n", filename.c_str());
+    std::remove(tmp.c_str());
+  }
+}
+
+}  // end namespace expt
+}  // end namespace RAJA
@@ -43,6 +43,7 @@ namespace RAJA {
 namespace util {
 
 KokkosPluginLoader::KokkosPluginLoader()
+  : Parent(forwarding_tag{})
 {
   char *env = getenv("KOKKOS_PLUGINS");
   if (env == nullptr)
@@ -61,7 +62,7 @@ void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.name(), 0, &(p.kID));
   }
 }
 
@@ -83,6 +84,10 @@ void KokkosPluginLoader::finalize()
   pre_functions.clear();
   post_functions.clear();
   finalize_functions.clear();
+  if (active) {
+    add_active_plugins(-1);
+    active = false;
+  }
 }
 
 // Initialize plugin from a shared object file specified by 'path'.
@@ -103,6 +108,12 @@ void KokkosPluginLoader::initPlugin(const std::string &path)
   getFunction<post_function>(plugin, post_functions, "kokkosp_end_parallel_for");
 
   getFunction<finalize_function>(plugin, finalize_functions, "kokkosp_finalize_library");
+
+  // the hooks are only needed once a tool takes part in kernel launches
+  if (!active && (!pre_functions.empty() || !post_functions.empty())) {
+    add_active_plugins(1);
+    active = true;
+  }
   #else
   RAJA_UNUSED_ARG(path);
   #endif
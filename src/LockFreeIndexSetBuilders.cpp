@@ -107,85 +107,79 @@ void buildLockFreeBlockIndexset(
     }
   } else { /* 3d mesh */
 
-    // this requires dependence graph - commenting out for now
-
     /* Need at least 3 full planes per thread */
     /* and at least one segment per plane */
-    /*
-        const int segmentsPerThread = 2;
-        int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
-        if (rowsPerSegment == 0) {
-          // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
-          iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
-          printf(
-              "Failure to create lockfree indexset - not enough rows per "
-              "segment\n");
-          exit(-1);
-        } else {
-    */
-    /* This just sets up the schedule -- a truly safe */
-    /* execution of this schedule would require a check */
-    /* for completion of dependent threads before execution. */
-
-    /* We might want to force one thread if the */
-    /* profitability ratio is really bad, but for */
-    /* now use the brain dead approach. */
-    /*
-          for (int lane = 0; lane < segmentsPerThread; ++lane) {
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::Index_type startPlane = i * slowDim / numThreads;
-              RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
-              RAJA::Index_type start = startPlane * fastDim * midDim;
-              RAJA::Index_type end = endPlane * fastDim * midDim;
-              RAJA::Index_type len = end - start;
-              // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
-              //                   start + (lane+1)*len/segmentsPerThread  );
-              iset.push_back(
-                  RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
-                                     start + (lane + 1) * len /
-       segmentsPerThread));
-            }
-          }
-    */
-    /* Allocate dependency graph structures for index set segments */
-    /*
-          iset.initDependencyGraph();
-
-          if (segmentsPerThread == 1) {
-    */
-    /* This dependency graph should impose serialization */
-    /*
-            for (int i = 0; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreValue() = ((i
-       == 0) ? 0 : 1); task->semaphoreReloadValue() = ((i == 0) ? 0 : 1); if (i
-       != numThreads - 1) { task->numDepTasks() = 1; task->depTaskNum(0) = i +
-       1;
-              }
-            }
-          } else {
-    */
-    /* This dependency graph relies on omp schedule(static, 1) */
-    /* but allows a minimumal set of dependent tasks be used */
-    /*
-            int borderSeg = numThreads * (segmentsPerThread - 1);
-            for (int i = 1; i < numThreads; ++i) {
-              RAJA::DepGraphNode* task =
-       iset.getSegmentInfo(i)->getDepGraphNode(); task->semaphoreReloadValue() =
-       1; task->numDepTasks() = 1; task->depTaskNum(0) = borderSeg + i - 1;
-
-              RAJA::DepGraphNode* border_task =
-                  iset.getSegmentInfo(borderSeg + i - 1)->getDepGraphNode();
-              border_task->semaphoreValue() = 1;
-              border_task->semaphoreReloadValue() = 1;
-              border_task->numDepTasks() = 1;
-              border_task->depTaskNum(0) = i;
-            }
-          }
+    const int segmentsPerThread = 2;
+    int rowsPerSegment = slowDim / (segmentsPerThread * numThreads);
+    if (rowsPerSegment == 0) {
+      /* Too few planes to divide, so the whole mesh is one segment */
+      // printf("%d %d\n", 0, fastDim*midDim*slowDim) ;
+      iset.push_back(RAJA::RangeSegment(0, fastDim * midDim * slowDim));
+      iset.initDependencyGraph();
+      iset.finalizeDependencyGraph();
+    } else {
+      /* This just sets up the schedule -- a safe execution of this */
+      /* schedule requires one of the taskgraph segment policies, */
+      /* which honor the dependency graph built below. */
+      for (int lane = 0; lane < segmentsPerThread; ++lane) {
+        for (int i = 0; i < numThreads; ++i) {
+          RAJA::Index_type startPlane = i * slowDim / numThreads;
+          RAJA::Index_type endPlane = (i + 1) * slowDim / numThreads;
+          RAJA::Index_type start = startPlane * fastDim * midDim;
+          RAJA::Index_type end = endPlane * fastDim * midDim;
+          RAJA::Index_type len = end - start;
+          // printf("%d %d\n", start + (lane  )*len/segmentsPerThread,
+          //                   start + (lane+1)*len/segmentsPerThread  );
+          iset.push_back(
+              RAJA::RangeSegment(start + (lane)*len / segmentsPerThread,
+                                 start + (lane + 1) * len / segmentsPerThread));
+        }
+      }
+
+      /* One segment per interval, so thread i of the interval policy */
+      /* runs segments i, i + numThreads, ... like schedule(static, 1) */
+      int numSegments = segmentsPerThread * numThreads;
+      for (int i = 0; i < numSegments; ++i) {
+        iset.setSegmentInterval(i, i, i + 1);
+      }
 
-          iset.finalizeDependencyGraph();
+      /* Allocate dependency graph structures for index set segments */
+      iset.initDependencyGraph();
+
+      if (segmentsPerThread == 1) {
+        /* This dependency graph should impose serialization */
+        for (int i = 0; i < numThreads; ++i) {
+          RAJA::DepGraphNode* task = iset.getDepGraphNode(i);
+          task->semaphoreValue() = ((i == 0) ? 0 : 1);
+          task->semaphoreReloadValue() = ((i == 0) ? 0 : 1);
+          if (i != numThreads - 1) {
+            task->numDepTasks() = 1;
+            task->depTaskNum(0) = i + 1;
+          }
         }
-    */
+      } else {
+        /* This dependency graph pipelines successive sweeps: the first */
+        /* lane of thread i may start once the last lane of thread i-1 */
+        /* finished the previous sweep, which in turn waits for the */
+        /* first lane of thread i in the current sweep. */
+        int borderSeg = numThreads * (segmentsPerThread - 1);
+        for (int i = 1; i < numThreads; ++i) {
+          RAJA::DepGraphNode* task = iset.getDepGraphNode(i);
+          task->semaphoreReloadValue() = 1;
+          task->numDepTasks() = 1;
+          task->depTaskNum(0) = borderSeg + i - 1;
+
+          RAJA::DepGraphNode* border_task =
+              iset.getDepGraphNode(borderSeg + i - 1);
+          border_task->semaphoreValue() = 1;
+          border_task->semaphoreReloadValue() = 1;
+          border_task->numDepTasks() = 1;
+          border_task->depTaskNum(0) = i;
+        }
+      }
+
+      iset.finalizeDependencyGraph();
+    }
   }
 
   /* Print the dependency schedule for segments */
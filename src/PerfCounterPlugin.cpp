@@ -0,0 +1,396 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PerfCounterPlugin.hpp"
+
+#include "PluginThreadRecords.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using RAJA::util::PerfCounterPlugin;
+
+namespace {
+
+constexpr int num_counters = PerfCounterPlugin::num_counters;
+
+const char* const counter_names[num_counters] = {"cycles",
+                                                 "instructions",
+                                                 "llc_misses",
+                                                 "branch_misses",
+                                                 "task_clock_ns",
+                                                 "page_faults"};
+
+//! Open counter c for the calling thread in the group of leader, or as a
+//! group leader if leader is -1. Returns the file descriptor or -1.
+int open_counter(int c, int leader)
+{
+#if defined(__linux__)
+  struct perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  switch (c) {
+    case PerfCounterPlugin::cycles:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case PerfCounterPlugin::instructions:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerfCounterPlugin::llc_misses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case PerfCounterPlugin::branch_misses:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case PerfCounterPlugin::task_clock_ns:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_TASK_CLOCK;
+      break;
+    default:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+      break;
+  }
+  // user space only, so unprivileged processes may count
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+  return static_cast<int>(fd);
+#else
+  (void)c;
+  (void)leader;
+  return -1;
+#endif
+}
+
+void close_counter(int fd)
+{
+#if defined(__linux__)
+  if (fd >= 0) {
+    close(fd);
+  }
+#else
+  (void)fd;
+#endif
+}
+
+//! counter values of a thread at one time
+struct Sample {
+  uint64_t values[num_counters];
+  uint64_t time_enabled;
+  uint64_t time_running;
+};
+
+struct KernelCounts {
+  long long count = 0;
+  double values[num_counters] = {};
+};
+
+//! counters of one thread, read by that thread around each kernel
+struct ThreadCounters : RAJA::util::detail::PluginThreadRecord {
+  ThreadCounters()
+  {
+    for (int c = 0; c < num_counters; ++c) {
+      fds[c] = open_counter(c, leader);
+      if (fds[c] >= 0) {
+        if (leader < 0) {
+          leader = fds[c];
+        }
+        group[num_open++] = c;
+      }
+    }
+  }
+
+  ~ThreadCounters() override { release(); }
+
+  //! close the counters, what was counted is kept
+  void release() override
+  {
+    for (int& fd : fds) {
+      close_counter(fd);
+      fd = -1;
+    }
+    leader = -1;
+  }
+
+  //! read all counters of the group with one system call
+  bool read(Sample& sample) const
+  {
+#if defined(__linux__)
+    uint64_t buf[3 + num_counters];
+    const ssize_t size = static_cast<ssize_t>((3 + num_open) * sizeof(uint64_t));
+    if (leader < 0 || ::read(leader, buf, size) != size) {
+      return false;
+    }
+    sample.time_enabled = buf[1];
+    sample.time_running = buf[2];
+    for (int i = 0; i < num_open; ++i) {
+      sample.values[group[i]] = buf[3 + i];
+    }
+    return true;
+#else
+    (void)sample;
+    return false;
+#endif
+  }
+
+  int fds[num_counters];
+  int leader = -1;
+  //! the counters in the order they are read
+  int group[num_counters];
+  int num_open = 0;
+
+  std::vector<Sample> starts;
+  RAJA::util::detail::KernelNameTable<KernelCounts> counts;
+};
+
+struct PerfCounterState {
+  std::atomic<bool> enabled{false};
+
+  RAJA::util::detail::PluginThreadRecords<ThreadCounters> records;
+
+  //! guards the prefix
+  std::mutex mutex;
+  std::string prefix;
+};
+
+PerfCounterState& perf_counter_state()
+{
+  static PerfCounterState state;
+  return state;
+}
+
+//! counters of the calling thread, opened on first use
+ThreadCounters* get_thread_counters(PerfCounterState& state)
+{
+  return state.records.get(
+      []() { return std::make_shared<ThreadCounters>(); });
+}
+
+using RAJA::util::detail::csv_escape;
+
+//! read the counters of the calling thread as a kernel starts on it
+void start_counting()
+{
+  PerfCounterState& state = perf_counter_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  ThreadCounters* record = get_thread_counters(state);
+  std::lock_guard<std::mutex> lock(record->mutex);
+  Sample sample;
+  if (!record->read(sample)) {
+    sample.time_enabled = 0;
+    sample.time_running = 0;
+  }
+  record->starts.push_back(sample);
+}
+
+//! add what the calling thread counted while running kernel p, the thread
+//! that launched p also counts the run
+void stop_counting(const RAJA::util::PluginContext& p, bool launched)
+{
+  PerfCounterState& state = perf_counter_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  ThreadCounters* record = get_thread_counters(state);
+  std::lock_guard<std::mutex> lock(record->mutex);
+  Sample end;
+  const bool read = record->read(end);
+  if (record->starts.empty()) {
+    // enabled while this kernel ran
+    return;
+  }
+  const Sample start = record->starts.back();
+  record->starts.pop_back();
+
+  KernelCounts& counts = record->counts[p.name()];
+  if (launched) {
+    ++counts.count;
+  }
+  if (!read || start.time_enabled == 0) {
+    return;
+  }
+
+  // scale up counts if the counters were multiplexed with others
+  const uint64_t enabled = end.time_enabled - start.time_enabled;
+  const uint64_t running = end.time_running - start.time_running;
+  const double scale = (running > 0 && running < enabled)
+                           ? static_cast<double>(enabled) / running
+                           : 1.0;
+  for (int i = 0; i < record->num_open; ++i) {
+    const int c = record->group[i];
+    counts.values[c] +=
+        static_cast<double>(end.values[c] - start.values[c]) * scale;
+  }
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace util {
+
+PerfCounterPlugin::PerfCounterPlugin()
+  : Parent(forwarding_tag{})
+{
+  char* env = getenv("RAJA_PERF_COUNTER_PLUGIN");
+  if (env != nullptr && env[0] != '\0') {
+    enable(std::string(env));
+  }
+}
+
+void PerfCounterPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  start_counting();
+}
+
+void PerfCounterPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  stop_counting(p, true);
+}
+
+void PerfCounterPlugin::preThreadLaunch(const RAJA::util::PluginContext&)
+{
+  start_counting();
+}
+
+void PerfCounterPlugin::postThreadLaunch(const RAJA::util::PluginContext& p)
+{
+  stop_counting(p, false);
+}
+
+void PerfCounterPlugin::finalize()
+{
+  if (enabled()) {
+    write();
+    disable();
+  }
+}
+
+void PerfCounterPlugin::enable(const std::string& prefix)
+{
+  PerfCounterState& state = perf_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.records.clear();
+  state.prefix = prefix;
+  if (!state.enabled.exchange(true)) {
+    add_active_plugins(1);
+  }
+}
+
+void PerfCounterPlugin::disable()
+{
+  PerfCounterState& state = perf_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.enabled.exchange(false)) {
+    add_active_plugins(-1);
+  }
+  state.records.clear();
+}
+
+bool PerfCounterPlugin::enabled()
+{
+  return perf_counter_state().enabled.load(std::memory_order_relaxed);
+}
+
+const char* PerfCounterPlugin::name(counter c)
+{
+  return counter_names[c];
+}
+
+bool PerfCounterPlugin::available(counter c)
+{
+  const int fd = open_counter(c, -1);
+  close_counter(fd);
+  return fd >= 0;
+}
+
+bool PerfCounterPlugin::write()
+{
+  PerfCounterState& state = perf_counter_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  // counters opened by any thread get a value in every row
+  bool opened[num_counters] = {};
+  std::map<std::string, KernelCounts> kernels;
+  state.records.for_each([&](const ThreadCounters& record) {
+    for (int i = 0; i < record.num_open; ++i) {
+      opened[record.group[i]] = true;
+    }
+    for (size_t id = 0; id < record.counts.size(); ++id) {
+      KernelCounts& sum = kernels[record.counts.names[id]];
+      sum.count += record.counts.values[id].count;
+      for (int c = 0; c < num_counters; ++c) {
+        sum.values[c] += record.counts.values[id].values[c];
+      }
+    }
+  });
+
+  const std::string filename = state.prefix + ".csv";
+  std::ofstream csv(filename);
+  csv << "kernel,count";
+  for (int c = 0; c < num_counters; ++c) {
+    csv << ',' << counter_names[c];
+  }
+  csv << ",ipc\n";
+
+  for (const auto& kernel : kernels) {
+    const KernelCounts& k = kernel.second;
+    csv << csv_escape(kernel.first) << ',' << k.count;
+    for (int c = 0; c < num_counters; ++c) {
+      csv << ',';
+      if (opened[c]) {
+        csv << static_cast<long long>(k.values[c] + 0.5);
+      }
+    }
+    csv << ',';
+    if (opened[cycles] && opened[instructions] && k.values[cycles] > 0.0) {
+      char buf[32];
+      std::snprintf(buf, sizeof(buf), "%.3f",
+                    k.values[instructions] / k.values[cycles]);
+      csv << buf;
+    }
+    csv << '\n';
+  }
+
+  if (!csv) {
+    printf("[PerfCounterPlugin]: could not write %s\n", filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+void linkPerfCounterPlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::PerfCounterPlugin> P(
+    "PerfCounterPlugin",
+    "Count cycles, instructions, and cache and branch misses per kernel.");
@@ -12,7 +12,52 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+namespace detail {
+
+std::atomic<int> num_active_plugins{0};
+
+const PluginContext*& CurrentPluginContext::get()
+{
+  static thread_local const PluginContext* current = nullptr;
+  return current;
+}
+
+}
+
+PluginStrategy::PluginStrategy()
+  : m_active(true)
+{
+  add_active_plugins(1);
+}
+
+PluginStrategy::PluginStrategy(forwarding_tag)
+  : m_active(false)
+{ }
+
+PluginStrategy::PluginStrategy(const PluginStrategy& other)
+  : m_active(other.m_active)
+{
+  if (m_active) {
+    add_active_plugins(1);
+  }
+}
+
+PluginStrategy& PluginStrategy::operator=(const PluginStrategy&)
+{
+  return *this;
+}
+
+PluginStrategy::~PluginStrategy()
+{
+  if (m_active) {
+    add_active_plugins(-1);
+  }
+}
+
+void PluginStrategy::add_active_plugins(int n)
+{
+  detail::num_active_plugins.fetch_add(n, std::memory_order_relaxed);
+}
 
 void PluginStrategy::init(const PluginOptions&) { }
 
@@ -24,6 +69,10 @@ void PluginStrategy::preLaunch(const PluginContext&) { }
 
 void PluginStrategy::postLaunch(const PluginContext&) { }
 
+void PluginStrategy::preThreadLaunch(const PluginContext&) { }
+
+void PluginStrategy::postThreadLaunch(const PluginContext&) { }
+
 void PluginStrategy::finalize() { }
 
 }
@@ -0,0 +1,204 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Per thread records shared by the plugins that measure kernels on the
+// threads that run them. Only included by the plugin sources.
+//
+
+#ifndef RAJA_src_PluginThreadRecords_HPP
+#define RAJA_src_PluginThreadRecords_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace RAJA {
+namespace util {
+namespace detail {
+
+/*!
+ * Base of what one thread records for a plugin. for_each and clear hold
+ * mutex while they use a record, so a thread that updates its record
+ * holding mutex never has it read while it changes. Plugins whose threads
+ * publish their updates with atomics instead do not take it.
+ */
+struct PluginThreadRecord {
+  virtual ~PluginThreadRecord() = default;
+
+  //! Called holding mutex when the record is dropped and when its thread
+  //! moves on or exits, to close what the record holds open, such as file
+  //! descriptors. May be called more than once. What was recorded is still
+  //! written.
+  virtual void release() {}
+
+  std::mutex mutex;
+
+  //! position in the list of records, used as the thread id in output
+  int tid = 0;
+};
+
+/*!
+ * The records of all threads of one plugin. Threads register a record on
+ * first use and keep a reference to it, so clear() never frees a record a
+ * thread is still using: it only drops the list, and each thread makes a new
+ * record the next time it asks for one. A dropped record is freed when its
+ * thread moves on to a new record or exits.
+ */
+template <typename Record>
+class PluginThreadRecords
+{
+public:
+  //! Record of the calling thread, made with make() if the thread has none
+  //! since the last clear(). The pointer stays valid until the calling
+  //! thread calls get again.
+  template <typename Make>
+  Record* get(Make&& make)
+  {
+    Holder& held = holder();
+    const unsigned generation = m_generation.load(std::memory_order_acquire);
+    if (held.record == nullptr || held.generation != generation) {
+      std::shared_ptr<Record> record = make();
+      std::lock_guard<std::mutex> lock(m_mutex);
+      record->tid = static_cast<int>(m_records.size());
+      m_records.push_back(record);
+      held.release();
+      held.record = std::move(record);
+      held.generation = m_generation.load(std::memory_order_relaxed);
+    }
+    return held.record.get();
+  }
+
+  //! Drop the records of all threads, threads that record again get new
+  //! records.
+  void clear()
+  {
+    std::vector<std::shared_ptr<Record>> dropped;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      dropped.swap(m_records);
+      m_generation.fetch_add(1, std::memory_order_release);
+    }
+    for (const std::shared_ptr<Record>& record : dropped) {
+      std::lock_guard<std::mutex> record_lock(record->mutex);
+      record->release();
+    }
+  }
+
+  //! Call f on each record in the order they were registered, holding the
+  //! mutex of the record. Threads that register meanwhile wait.
+  template <typename F>
+  void for_each(F&& f)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const std::shared_ptr<Record>& record : m_records) {
+      std::lock_guard<std::mutex> record_lock(record->mutex);
+      f(static_cast<const Record&>(*record));
+    }
+  }
+
+private:
+  //! the record of a thread, released when the thread exits
+  struct Holder {
+    std::shared_ptr<Record> record;
+    unsigned generation = 0;
+
+    void release()
+    {
+      if (record) {
+        std::lock_guard<std::mutex> lock(record->mutex);
+        record->release();
+      }
+      record.reset();
+    }
+
+    ~Holder() { release(); }
+  };
+
+  static Holder& holder()
+  {
+    static thread_local Holder held;
+    return held;
+  }
+
+  std::mutex m_mutex;
+  //! changes whenever the records are dropped, so threads register again
+  std::atomic<unsigned> m_generation{1};
+  std::vector<std::shared_ptr<Record>> m_records;
+};
+
+/*!
+ * Values kept per kernel name by one thread. Names are compared by pointer
+ * first as they are usually literals or the static policy names, and the
+ * same kernel usually runs many times in a row.
+ */
+template <typename Value>
+class KernelNameTable
+{
+public:
+  //! small id of name, the index of its value
+  size_t id(const char* name)
+  {
+    if (name == m_last_name && m_last_id < names.size() &&
+        names[m_last_id] == name) {
+      return m_last_id;
+    }
+    m_last_name = name;
+    auto found = m_ids.find(name);
+    if (found != m_ids.end() && names[found->second] == name) {
+      m_last_id = found->second;
+      return m_last_id;
+    }
+    size_t id = static_cast<size_t>(
+        std::find(names.begin(), names.end(), name) - names.begin());
+    if (id == names.size()) {
+      names.emplace_back(name);
+      values.emplace_back();
+    }
+    m_ids[name] = id;
+    m_last_id = id;
+    return id;
+  }
+
+  Value& operator[](const char* name) { return values[id(name)]; }
+
+  size_t size() const { return names.size(); }
+
+  std::vector<std::string> names;
+  std::vector<Value> values;
+
+private:
+  std::unordered_map<const char*, size_t> m_ids;
+  const char* m_last_name = nullptr;
+  size_t m_last_id = 0;
+};
+
+//! s as a quoted CSV field
+inline std::string csv_escape(const std::string& s)
+{
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"') {
+      out += '"';
+    }
+    out += c;
+  }
+  out += '"';
+  return out;
+}
+
+}  // end namespace detail
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,316 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/RooflinePlugin.hpp"
+
+#include "PluginThreadRecords.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using roofline_clock = std::chrono::steady_clock;
+
+//! time and declared cost of the runs of one kernel name
+struct KernelCosts {
+  long long count = 0;
+  double seconds = 0.0;
+  double bytes = 0.0;
+  double flops = 0.0;
+
+  void merge(const KernelCosts& other)
+  {
+    count += other.count;
+    seconds += other.seconds;
+    bytes += other.bytes;
+    flops += other.flops;
+  }
+};
+
+//! what one thread recorded
+struct ThreadCosts : RAJA::util::detail::PluginThreadRecord {
+  std::vector<roofline_clock::time_point> starts;
+  RAJA::util::detail::KernelNameTable<KernelCosts> costs;
+};
+
+struct RooflineState {
+  std::atomic<bool> enabled{false};
+
+  RAJA::util::detail::PluginThreadRecords<ThreadCosts> records;
+
+  //! guards the settings below
+  std::mutex mutex;
+  std::string prefix;
+  double peak_bandwidth = 0.0;
+  double peak_flops = 0.0;
+};
+
+RooflineState& roofline_state()
+{
+  static RooflineState state;
+  return state;
+}
+
+//! record of the calling thread, registered on first use
+ThreadCosts* get_thread_costs(RooflineState& state)
+{
+  return state.records.get([]() { return std::make_shared<ThreadCosts>(); });
+}
+
+using RAJA::util::detail::csv_escape;
+
+//! value or an empty field if it is not known
+std::string csv_value(double value, bool known)
+{
+  if (!known) {
+    return std::string();
+  }
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.6e", value);
+  return std::string(buf);
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace util {
+
+RooflinePlugin::RooflinePlugin()
+  : Parent(forwarding_tag{})
+{
+  char* env = getenv("RAJA_ROOFLINE_PLUGIN");
+  if (env != nullptr && env[0] != '\0') {
+    enable(std::string(env));
+  }
+}
+
+void RooflinePlugin::init(const RAJA::util::PluginOptions&)
+{
+  // measuring the peak takes time and memory, so only when asked for
+  char* env = getenv("RAJA_ROOFLINE_CALIBRATE");
+  const bool asked = env != nullptr && env[0] != '\0';
+  if (asked && enabled() && peak_bandwidth() == 0.0) {
+    calibrate();
+  }
+}
+
+void RooflinePlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  RooflineState& state = roofline_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  ThreadCosts* record = get_thread_costs(state);
+  std::lock_guard<std::mutex> lock(record->mutex);
+  record->starts.push_back(roofline_clock::now());
+}
+
+void RooflinePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const roofline_clock::time_point end = roofline_clock::now();
+  RooflineState& state = roofline_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  ThreadCosts* record = get_thread_costs(state);
+  std::lock_guard<std::mutex> lock(record->mutex);
+  if (record->starts.empty()) {
+    // enabled while this kernel ran
+    return;
+  }
+  const roofline_clock::time_point start = record->starts.back();
+  record->starts.pop_back();
+
+  KernelCosts& costs = record->costs[p.name()];
+  ++costs.count;
+  costs.seconds += std::chrono::duration<double>(end - start).count();
+  if (p.num_iterations > 0) {
+    const double n = static_cast<double>(p.num_iterations);
+    costs.bytes += p.bytes_per_iteration * n;
+    costs.flops += p.flops_per_iteration * n;
+  }
+}
+
+void RooflinePlugin::finalize()
+{
+  if (enabled()) {
+    write();
+    disable();
+  }
+}
+
+void RooflinePlugin::enable(const std::string& prefix)
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.records.clear();
+  state.prefix = prefix;
+  if (!state.enabled.exchange(true)) {
+    add_active_plugins(1);
+  }
+}
+
+void RooflinePlugin::disable()
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.enabled.exchange(false)) {
+    add_active_plugins(-1);
+  }
+  state.records.clear();
+}
+
+bool RooflinePlugin::enabled()
+{
+  return roofline_state().enabled.load(std::memory_order_relaxed);
+}
+
+double RooflinePlugin::peak_bandwidth()
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.peak_bandwidth;
+}
+
+double RooflinePlugin::peak_flops()
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.peak_flops;
+}
+
+void RooflinePlugin::set_peak_bandwidth(double bytes_per_second)
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.peak_bandwidth = bytes_per_second;
+}
+
+void RooflinePlugin::set_peak_flops(double flops_per_second)
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.peak_flops = flops_per_second;
+}
+
+double RooflinePlugin::calibrate(size_t array_size)
+{
+  const long long n = static_cast<long long>(array_size);
+  std::unique_ptr<double[]> a(new double[array_size]);
+  std::unique_ptr<double[]> b(new double[array_size]);
+  std::unique_ptr<double[]> c(new double[array_size]);
+  double* pa = a.get();
+  double* pb = b.get();
+  double* pc = c.get();
+
+  // first touch the arrays the way the triad accesses them
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+  for (long long i = 0; i < n; ++i) {
+    pa[i] = 0.0;
+    pb[i] = 1.0;
+    pc[i] = 2.0;
+  }
+
+  // best of several triads, counting the bytes read and written as STREAM
+  // does, without the reads for write allocation
+  const double scalar = 3.0;
+  double best = 0.0;
+  for (int rep = 0; rep < 10; ++rep) {
+    const roofline_clock::time_point start = roofline_clock::now();
+#if defined(RAJA_ENABLE_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (long long i = 0; i < n; ++i) {
+      pa[i] = pb[i] + scalar * pc[i];
+    }
+    const double seconds =
+        std::chrono::duration<double>(roofline_clock::now() - start).count();
+    if (seconds > 0.0) {
+      best = std::max(best, 3.0 * sizeof(double) * array_size / seconds);
+    }
+  }
+
+  set_peak_bandwidth(best);
+  return best;
+}
+
+bool RooflinePlugin::write()
+{
+  RooflineState& state = roofline_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  std::map<std::string, KernelCosts> kernels;
+  state.records.for_each([&](const ThreadCosts& record) {
+    for (size_t id = 0; id < record.costs.size(); ++id) {
+      kernels[record.costs.names[id]].merge(record.costs.values[id]);
+    }
+  });
+
+  // the kernels that take the most time first
+  std::vector<std::pair<std::string, KernelCosts>> sorted(kernels.begin(),
+                                                          kernels.end());
+  std::stable_sort(sorted.begin(),
+                   sorted.end(),
+                   [](const std::pair<std::string, KernelCosts>& l,
+                      const std::pair<std::string, KernelCosts>& r) {
+                     return l.second.seconds > r.second.seconds;
+                   });
+
+  const std::string filename = state.prefix + ".csv";
+  std::ofstream csv(filename);
+  csv << "kernel,count,total_s,bytes,flops,GB_per_s,GFLOP_per_s,"
+         "flops_per_byte,fraction_of_peak_bandwidth,fraction_of_peak_flops,"
+         "peak_GB_per_s,peak_GFLOP_per_s\n";
+  for (const auto& kernel : sorted) {
+    const KernelCosts& k = kernel.second;
+    const bool timed = k.seconds > 0.0;
+    const double bandwidth = timed ? k.bytes / k.seconds : 0.0;
+    const double flop_rate = timed ? k.flops / k.seconds : 0.0;
+    csv << csv_escape(kernel.first) << ',' << k.count << ','
+        << csv_value(k.seconds, true) << ',' << csv_value(k.bytes, true)
+        << ',' << csv_value(k.flops, true) << ','
+        << csv_value(bandwidth * 1e-9, timed && k.bytes > 0.0) << ','
+        << csv_value(flop_rate * 1e-9, timed && k.flops > 0.0) << ','
+        << csv_value(k.flops / k.bytes, k.bytes > 0.0) << ','
+        << csv_value(bandwidth / state.peak_bandwidth,
+                     timed && k.bytes > 0.0 && state.peak_bandwidth > 0.0)
+        << ','
+        << csv_value(flop_rate / state.peak_flops,
+                     timed && k.flops > 0.0 && state.peak_flops > 0.0)
+        << ',' << csv_value(state.peak_bandwidth * 1e-9,
+                            state.peak_bandwidth > 0.0)
+        << ',' << csv_value(state.peak_flops * 1e-9, state.peak_flops > 0.0)
+        << '\n';
+  }
+
+  if (!csv) {
+    printf("[RooflinePlugin]: could not write %s\n", filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+void linkRooflinePlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::RooflinePlugin> P(
+    "RooflinePlugin",
+    "Report achieved bandwidth and flop rates against measured peaks.");
@@ -23,6 +23,7 @@ namespace RAJA {
 namespace util {
   
 RuntimePluginLoader::RuntimePluginLoader()
+  : Parent(forwarding_tag{})
 {
   char *env = ::getenv("RAJA_PLUGINS");
   if (nullptr == env)
@@ -73,6 +74,22 @@ void RuntimePluginLoader::postLaunch(const RAJA::util::PluginContext& p)
   }
 }
 
+void RuntimePluginLoader::preThreadLaunch(const RAJA::util::PluginContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->preThreadLaunch(p);
+  }
+}
+
+void RuntimePluginLoader::postThreadLaunch(const RAJA::util::PluginContext& p)
+{
+  for (auto &plugin : plugins)
+  {
+    plugin->postThreadLaunch(p);
+  }
+}
+
 void RuntimePluginLoader::finalize()
 {
   for (auto &plugin : plugins)
@@ -5,94 +5,260 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_VECTOR_STATS)
+
 #include "RAJA/pattern/tensor/stats.hpp"
+#include "RAJA/util/PluginStrategy.hpp"
+
 #include <stdio.h>
 
-int RAJA::tensor_stats::indent = 0;
+#include <memory>
+#include <mutex>
+#include <vector>
 
-camp::idx_t RAJA::tensor_stats::num_vector_copy = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_copy_ctor = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast_ctor = 0;
+using RAJA::expt::tensor_stats;
 
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_load_strided_n = 0;
+namespace {
 
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_packed_n = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_store_strided_n = 0;
+const char* const stat_names[] = {
+  "num_vector_copy",
+  "num_vector_copy_ctor",
+  "num_vector_broadcast_ctor",
 
-camp::idx_t RAJA::tensor_stats::num_vector_broadcast = 0;
+  "num_vector_load_packed",
+  "num_vector_load_packed_n",
+  "num_vector_load_strided",
+  "num_vector_load_strided_n",
 
-camp::idx_t RAJA::tensor_stats::num_vector_get = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_set = 0;
+  "num_vector_store_packed",
+  "num_vector_store_packed_n",
+  "num_vector_store_strided",
+  "num_vector_store_strided_n",
 
-camp::idx_t RAJA::tensor_stats::num_vector_add = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_subtract = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_multiply = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_divide = 0;
+  "num_vector_broadcast",
 
-camp::idx_t RAJA::tensor_stats::num_vector_fma = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_fms = 0;
+  "num_vector_get",
+  "num_vector_set",
 
-camp::idx_t RAJA::tensor_stats::num_vector_sum = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_max = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_min = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmax = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_vmin = 0;
-camp::idx_t RAJA::tensor_stats::num_vector_dot = 0;
+  "num_vector_add",
+  "num_vector_subtract",
+  "num_vector_multiply",
+  "num_vector_divide",
 
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_row_row = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_mult_col_col = 0;
-camp::idx_t RAJA::tensor_stats::num_matrix_mm_multacc_col_col = 0;
+  "num_vector_fma",
+  "num_vector_fms",
 
-void RAJA::tensor_stats::resetVectorStats(){
-  num_vector_copy = 0;
-  num_vector_copy_ctor = 0;
-  num_vector_broadcast_ctor = 0;
+  "num_vector_sum",
+  "num_vector_max",
+  "num_vector_min",
+  "num_vector_vmax",
+  "num_vector_vmin",
+  "num_vector_dot",
 
-  num_vector_load_packed = 0;
-  num_vector_load_packed_n = 0;
-  num_vector_load_strided = 0;
-  num_vector_load_strided_n = 0;
-  num_vector_store_packed = 0;
-  num_vector_store_packed_n = 0;
-  num_vector_store_strided = 0;
-  num_vector_store_strided_n = 0;
+  "num_matrix_mm_mult_row_row",
+  "num_matrix_mm_multacc_row_row",
+  "num_matrix_mm_mult_col_col",
+  "num_matrix_mm_multacc_col_col"
+};
 
-  num_vector_broadcast = 0;
+static_assert(sizeof(stat_names) / sizeof(stat_names[0]) ==
+                  tensor_stats::num_stats,
+              "a tensor_stats counter has no name");
 
-  num_vector_get = 0;
-  num_vector_set = 0;
+//! counters of one thread, a block per kernel name. Only the thread adds
+//! blocks, under the mutex so readers can walk them.
+struct ThreadStats {
+  std::mutex mutex;
+  std::map<std::string, std::unique_ptr<tensor_stats::counter_block>> blocks;
+  std::vector<tensor_stats::counter_block*> kernel_stack;
 
-  num_vector_add = 0;
-  num_vector_subtract = 0;
-  num_vector_multiply = 0;
-  num_vector_divide = 0;
+  tensor_stats::counter_block* block(const char* kernel_name)
+  {
+    auto found = blocks.find(kernel_name);
+    if (found != blocks.end()) {
+      return found->second.get();
+    }
+    std::unique_ptr<tensor_stats::counter_block> new_block(
+        new tensor_stats::counter_block);
+    for (auto& value : new_block->values) {
+      value.store(0, std::memory_order_relaxed);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    return blocks.emplace(kernel_name, std::move(new_block))
+        .first->second.get();
+  }
+};
 
-  num_vector_fma = 0;
-  num_vector_fms = 0;
-  num_vector_sum = 0;
-  num_vector_max = 0;
-  num_vector_min = 0;
-  num_vector_vmax = 0;
-  num_vector_vmin = 0;
-  num_vector_dot = 0;
+struct StatsState {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadStats>> threads;
+};
 
-  num_matrix_mm_mult_row_row = 0;
-  num_matrix_mm_multacc_row_row = 0;
-  num_matrix_mm_mult_col_col = 0;
-  num_matrix_mm_multacc_col_col = 0;
+StatsState& stats_state()
+{
+  static StatsState state;
+  return state;
 }
 
-#define PRINT_STAT(STAT) if(STAT){printf("  %-32s   %ld\n", #STAT, STAT);}
+thread_local ThreadStats* this_thread_stats = nullptr;
 
-void RAJA::tensor_stats::printVectorStats(){
+ThreadStats* get_thread_stats()
+{
+  if (this_thread_stats == nullptr) {
+    StatsState& state = stats_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.threads.emplace_back(new ThreadStats);
+    this_thread_stats = state.threads.back().get();
+  }
+  return this_thread_stats;
+}
 
-  printf("RAJA SIMD Register Statistics:\n");
+//! call f(kernel_name, block) for every block of every thread
+template <typename F>
+void for_each_block(F&& f)
+{
+  StatsState& state = stats_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  for (const auto& thread : state.threads) {
+    std::lock_guard<std::mutex> thread_lock(thread->mutex);
+    for (auto& block : thread->blocks) {
+      f(block.first, *block.second);
+    }
+  }
+}
+
+void add_counts(tensor_stats::counts& sum,
+                const tensor_stats::counter_block& block)
+{
+  for (int s = 0; s < tensor_stats::num_stats; ++s) {
+    sum[s] += block.values[s].load(std::memory_order_relaxed);
+  }
+}
+
+//! Switches the counters of a thread to the kernel it runs while kernels
+//! are attributed, see tensor_stats::attributeToKernels.
+class TensorStatsPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  TensorStatsPlugin() : RAJA::util::PluginStrategy(forwarding_tag{}) { }
+
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    if (!attributing.load(std::memory_order_relaxed)) {
+      return;
+    }
+    ThreadStats* stats = get_thread_stats();
+    if (tensor_stats::current_block == nullptr) {
+      tensor_stats::registerThread();
+    }
+    stats->kernel_stack.push_back(tensor_stats::current_block);
+    tensor_stats::current_block = stats->block(p.name());
+  }
+
+  void postLaunch(const RAJA::util::PluginContext&) override
+  {
+    ThreadStats* stats = this_thread_stats;
+    if (stats == nullptr || stats->kernel_stack.empty()) {
+      return;
+    }
+    tensor_stats::current_block = stats->kernel_stack.back();
+    stats->kernel_stack.pop_back();
+  }
+
+  //! the other threads of a host parallel region count into the block of
+  //! the kernel they run a part of too
+  void preThreadLaunch(const RAJA::util::PluginContext& p) override
+  {
+    preLaunch(p);
+  }
+
+  void postThreadLaunch(const RAJA::util::PluginContext& p) override
+  {
+    postLaunch(p);
+  }
+
+  static void attribute(bool on)
+  {
+    if (attributing.exchange(on) != on) {
+      add_active_plugins(on ? 1 : -1);
+    }
+  }
+
+private:
+  static std::atomic<bool> attributing;
+};
+
+std::atomic<bool> TensorStatsPlugin::attributing{false};
+
+}  // end anonymous namespace
+
+int RAJA::expt::tensor_stats::indent = 0;
+
+thread_local tensor_stats::counter_block*
+    RAJA::expt::tensor_stats::current_block = nullptr;
+
+tensor_stats::counter_block* RAJA::expt::tensor_stats::registerThread()
+{
+  current_block = get_thread_stats()->block("");
+  return current_block;
+}
+
+const char* RAJA::expt::tensor_stats::name(stat s)
+{
+  return stat_names[s];
+}
+
+camp::idx_t RAJA::expt::tensor_stats::total(stat s)
+{
+  camp::idx_t sum = 0;
+  for_each_block([&](const std::string&, const counter_block& block) {
+    sum += block.values[s].load(std::memory_order_relaxed);
+  });
+  return sum;
+}
+
+tensor_stats::counts RAJA::expt::tensor_stats::totals()
+{
+  counts sum{};
+  for_each_block([&](const std::string&, const counter_block& block) {
+    add_counts(sum, block);
+  });
+  return sum;
+}
+
+std::map<std::string, tensor_stats::counts>
+RAJA::expt::tensor_stats::kernelTotals()
+{
+  std::map<std::string, counts> sums;
+  for_each_block([&](const std::string& kernel_name,
+                     const counter_block& block) {
+    auto found = sums.find(kernel_name);
+    if (found == sums.end()) {
+      found = sums.emplace(kernel_name, counts{}).first;
+    }
+    add_counts(found->second, block);
+  });
+  return sums;
+}
+
+void RAJA::expt::tensor_stats::attributeToKernels(bool on)
+{
+  TensorStatsPlugin::attribute(on);
+}
+
+void RAJA::expt::tensor_stats::resetVectorStats(){
+  for_each_block([](const std::string&, counter_block& block) {
+    for (auto& value : block.values) {
+      value.store(0, std::memory_order_relaxed);
+    }
+  });
+}
+
+#define PRINT_STAT(STAT) if(stats[tensor_stats::STAT]){printf("  %-32s   %lld\n", #STAT, static_cast<long long>(stats[tensor_stats::STAT]));}
+
+static void printStats(const tensor_stats::counts& stats){
 
   PRINT_STAT(num_vector_copy);
   PRINT_STAT(num_vector_copy_ctor);
@@ -131,3 +297,82 @@ void RAJA::tensor_stats::printVectorStats(){
   PRINT_STAT(num_matrix_mm_multacc_col_col);
 
 }
+
+void RAJA::expt::tensor_stats::printVectorStats(){
+
+  printf("RAJA SIMD Register Statistics:\n");
+
+  printStats(totals());
+
+  std::map<std::string, counts> kernels = kernelTotals();
+  if (kernels.size() > 1 || (kernels.size() == 1 && !kernels.count(""))) {
+    for (const auto& kernel : kernels) {
+      printf(" Kernel %s:\n",
+             kernel.first.empty() ? "(none)" : kernel.first.c_str());
+      printStats(kernel.second);
+    }
+  }
+
+}
+
+static void writeJSONString(FILE* file, const std::string& s)
+{
+  fputc('"', file);
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      fputc('\\', file);
+      fputc(c, file);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      fprintf(file, "\\u%04x", static_cast<unsigned>(c));
+    } else {
+      fputc(c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static void writeJSONCounts(FILE* file, const tensor_stats::counts& stats)
+{
+  fputc('{', file);
+  for (int s = 0; s < tensor_stats::num_stats; ++s) {
+    fprintf(file, "%s\"%s\":%lld", s == 0 ? "" : ",",
+            tensor_stats::name(static_cast<tensor_stats::stat>(s)),
+            static_cast<long long>(stats[s]));
+  }
+  fputc('}', file);
+}
+
+bool RAJA::expt::tensor_stats::writeVectorStats(const std::string& filename){
+  FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  size_t num_threads = 0;
+  {
+    StatsState& state = stats_state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    num_threads = state.threads.size();
+  }
+
+  fprintf(file, "{\"threads\":%zu,\n\"totals\":", num_threads);
+  writeJSONCounts(file, totals());
+  fprintf(file, ",\n\"kernels\":{");
+  bool first = true;
+  for (const auto& kernel : kernelTotals()) {
+    fprintf(file, "%s\n", first ? "" : ",");
+    writeJSONString(file, kernel.first);
+    fputc(':', file);
+    writeJSONCounts(file, kernel.second);
+    first = false;
+  }
+  fprintf(file, "\n}}\n");
+
+  return fclose(file) == 0;
+}
+
+static RAJA::util::PluginRegistry::add<TensorStatsPlugin> P(
+    "TensorStatsPlugin",
+    "Attribute tensor_stats counters to the kernels that count them.");
+
+#endif  // if defined(RAJA_ENABLE_VECTOR_STATS)
@@ -0,0 +1,188 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Implementation file for the persistent thread pool.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <cstdlib>
+
+#include "RAJA/internal/ThreadPool.hpp"
+
+namespace RAJA
+{
+
+namespace thread_pool
+{
+
+namespace
+{
+
+//! pool thread id of the calling thread, see ThreadPool::thread_id()
+thread_local int t_thread_id = -1;
+
+//! iterations an idle thread polls before parking
+constexpr int default_spin_iterations = 1 << 10;
+
+inline void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+int default_num_threads()
+{
+  if (const char* env = std::getenv("RAJA_NUM_THREADS")) {
+    const int num_threads = std::atoi(env);
+    if (num_threads > 0) {
+      return num_threads;
+    }
+  }
+  const unsigned hw_threads = std::thread::hardware_concurrency();
+  return hw_threads > 0 ? static_cast<int>(hw_threads) : 1;
+}
+
+}  // namespace
+
+ThreadPool& ThreadPool::get()
+{
+  static ThreadPool pool(default_num_threads());
+  return pool;
+}
+
+int ThreadPool::thread_id() { return t_thread_id; }
+
+ThreadPool::ThreadPool(int num_threads)
+    : m_num_threads(num_threads),
+      // spinning only pays off when every pool thread has a core to itself
+      m_spin_iterations(
+          num_threads <= static_cast<int>(std::thread::hardware_concurrency())
+              ? default_spin_iterations
+              : 0)
+{
+  m_workers.reserve(num_threads - 1);
+  for (int tid = 1; tid < num_threads; ++tid) {
+    m_workers.emplace_back(&ThreadPool::worker_loop, this, tid);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_park_mutex);
+    m_stop.store(true);
+    m_generation.fetch_add(1);
+  }
+  m_park_cv.notify_all();
+
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::run(task_type task, void* data)
+{
+  // nested or concurrent fork: run serially on the calling thread
+  if (m_num_threads == 1 || t_thread_id >= 0 || !m_run_mutex.try_lock()) {
+    task(data, 0, 1);
+    return;
+  }
+
+  t_thread_id = 0;
+
+  m_task = task;
+  m_data = data;
+  m_remaining.store(m_num_threads - 1, std::memory_order_relaxed);
+
+  // publishes the task; pairs with the parked check in wait_for_work
+  m_generation.fetch_add(1);
+  if (m_num_parked.load() > 0) {
+    std::lock_guard<std::mutex> lock(m_park_mutex);
+    m_park_cv.notify_all();
+  }
+
+  task(data, 0, m_num_threads);
+
+  wait_for_join();
+
+  t_thread_id = -1;
+  m_run_mutex.unlock();
+}
+
+unsigned ThreadPool::wait_for_work(unsigned seen)
+{
+  for (int spin = 0; spin < m_spin_iterations; ++spin) {
+    const unsigned gen = m_generation.load(std::memory_order_acquire);
+    if (gen != seen) {
+      return gen;
+    }
+    cpu_relax();
+  }
+
+  std::unique_lock<std::mutex> lock(m_park_mutex);
+  m_num_parked.fetch_add(1);
+  unsigned gen = seen;
+  m_park_cv.wait(lock, [&]() {
+    gen = m_generation.load();
+    return gen != seen;
+  });
+  m_num_parked.fetch_sub(1);
+  return gen;
+}
+
+void ThreadPool::wait_for_join()
+{
+  for (int spin = 0; spin < m_spin_iterations; ++spin) {
+    if (m_remaining.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+    cpu_relax();
+  }
+
+  std::unique_lock<std::mutex> lock(m_park_mutex);
+  m_join_parked.store(true);
+  m_join_cv.wait(lock, [&]() { return m_remaining.load() == 0; });
+  m_join_parked.store(false, std::memory_order_relaxed);
+}
+
+void ThreadPool::worker_loop(int tid)
+{
+  t_thread_id = tid;
+
+  unsigned seen = 0;
+  for (;;) {
+    seen = wait_for_work(seen);
+    if (m_stop.load(std::memory_order_acquire)) {
+      return;
+    }
+    m_task(m_data, tid, m_num_threads);
+    // the last worker to finish wakes the caller if it stopped spinning
+    if (m_remaining.fetch_sub(1) == 1 && m_join_parked.load()) {
+      std::lock_guard<std::mutex> lock(m_park_mutex);
+      m_join_cv.notify_one();
+    }
+  }
+}
+
+}  // namespace thread_pool
+
+}  // namespace RAJA
+
+#endif  // RAJA_ENABLE_THREAD_POOL
@@ -0,0 +1,459 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/TimingPlugin.hpp"
+
+#include "PluginThreadRecords.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using timing_clock = std::chrono::steady_clock;
+
+//! times of one kernel name on one thread, in seconds
+struct KernelStats {
+  long long count = 0;
+  double total = 0.0;
+  double min = 0.0;
+  double max = 0.0;
+
+  void add(double t)
+  {
+    min = (count == 0 || t < min) ? t : min;
+    max = (count == 0 || t > max) ? t : max;
+    total += t;
+    ++count;
+  }
+
+  void merge(const KernelStats& other)
+  {
+    if (other.count == 0) {
+      return;
+    }
+    min = (count == 0 || other.min < min) ? other.min : min;
+    max = (count == 0 || other.max > max) ? other.max : max;
+    total += other.total;
+    count += other.count;
+  }
+};
+
+//! times of one kernel name on one thread, as write() reads them
+struct PublishedStats {
+  std::string name;
+  std::atomic<long long> count{0};
+  std::atomic<double> total{0.0};
+  std::atomic<double> min{0.0};
+  std::atomic<double> max{0.0};
+
+  void store(const KernelStats& stats)
+  {
+    count.store(stats.count, std::memory_order_relaxed);
+    total.store(stats.total, std::memory_order_relaxed);
+    min.store(stats.min, std::memory_order_relaxed);
+    max.store(stats.max, std::memory_order_relaxed);
+  }
+
+  KernelStats load() const
+  {
+    KernelStats stats;
+    stats.count = count.load(std::memory_order_relaxed);
+    stats.total = total.load(std::memory_order_relaxed);
+    stats.min = min.load(std::memory_order_relaxed);
+    stats.max = max.load(std::memory_order_relaxed);
+    return stats;
+  }
+};
+
+struct TraceEvent {
+  uint32_t name;
+  long long num_iterations;
+  timing_clock::time_point start;
+  timing_clock::duration duration;
+};
+
+//! Elements one thread appends and other threads read without locks. The
+//! elements live in chunks of doubling size that are never moved, so
+//! appending does not copy the ones before it, and readers see the first
+//! size() of them.
+template <typename T>
+class PublishedBuffer
+{
+public:
+  PublishedBuffer() = default;
+  PublishedBuffer(const PublishedBuffer&) = delete;
+  PublishedBuffer& operator=(const PublishedBuffer&) = delete;
+
+  ~PublishedBuffer()
+  {
+    for (T* chunk : m_chunks) {
+      delete[] chunk;
+    }
+  }
+
+  //! the element after the published ones, for the owning thread to fill
+  //! in before it calls publish()
+  T& next()
+  {
+    const size_t i = m_size.load(std::memory_order_relaxed);
+    const size_t chunk = chunk_of(i);
+    if (m_chunks[chunk] == nullptr) {
+      m_chunks[chunk] = new T[first_chunk_size << chunk];
+    }
+    return m_chunks[chunk][i - chunk_begin(chunk)];
+  }
+
+  //! make the element returned by next() visible to other threads
+  void publish()
+  {
+    m_size.store(m_size.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_release);
+  }
+
+  size_t size() const { return m_size.load(std::memory_order_acquire); }
+
+  T& operator[](size_t i)
+  {
+    const size_t chunk = chunk_of(i);
+    return m_chunks[chunk][i - chunk_begin(chunk)];
+  }
+
+  const T& operator[](size_t i) const
+  {
+    const size_t chunk = chunk_of(i);
+    return m_chunks[chunk][i - chunk_begin(chunk)];
+  }
+
+private:
+  static constexpr size_t first_chunk_size = 64;
+  static constexpr size_t max_chunks = 48;
+
+  static size_t chunk_of(size_t i)
+  {
+    size_t j = i / first_chunk_size + 1;
+    size_t chunk = 0;
+    while (j >>= 1) {
+      ++chunk;
+    }
+    return chunk;
+  }
+
+  static size_t chunk_begin(size_t chunk)
+  {
+    return first_chunk_size * ((size_t(1) << chunk) - 1);
+  }
+
+  T* m_chunks[max_chunks] = {};
+  std::atomic<size_t> m_size{0};
+};
+
+//! Everything one thread recorded. Only the thread changes its record, and
+//! it does so without locks: write() reads the published events and kernel
+//! names, and the stats of the kernels between two equal even values of
+//! sequence, which the thread makes odd while it updates them.
+struct ThreadRecord : RAJA::util::detail::PluginThreadRecord {
+  // used only by the thread
+  std::vector<timing_clock::time_point> starts;
+  RAJA::util::detail::KernelNameTable<KernelStats> stats;
+
+  // read by write()
+  PublishedBuffer<PublishedStats> kernels;
+  PublishedBuffer<TraceEvent> events;
+  std::atomic<size_t> dropped_events{0};
+  std::atomic<unsigned> sequence{0};
+};
+
+//! stats of the first num_kernels kernels of record, all from between the
+//! same two updates
+std::vector<KernelStats> snapshot_stats(const ThreadRecord& record,
+                                        size_t num_kernels)
+{
+  std::vector<KernelStats> stats(num_kernels);
+  for (;;) {
+    const unsigned before = record.sequence.load(std::memory_order_acquire);
+    if ((before & 1u) == 0) {
+      for (size_t id = 0; id < num_kernels; ++id) {
+        stats[id] = record.kernels[id].load();
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (record.sequence.load(std::memory_order_relaxed) == before) {
+        return stats;
+      }
+    }
+    std::this_thread::yield();
+  }
+}
+
+struct TimingState {
+  std::atomic<bool> enabled{false};
+  std::atomic<size_t> max_events{0};
+
+  RAJA::util::detail::PluginThreadRecords<ThreadRecord> records;
+
+  //! guards the settings below
+  std::mutex mutex;
+  std::string prefix;
+  timing_clock::time_point epoch;
+};
+
+TimingState& timing_state()
+{
+  static TimingState state;
+  return state;
+}
+
+//! record of the calling thread, registered on first use
+ThreadRecord* get_thread_record(TimingState& state)
+{
+  return state.records.get([]() { return std::make_shared<ThreadRecord>(); });
+}
+
+std::string json_escape(const std::string& s)
+{
+  std::string out;
+  out.reserve(s.size());
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+      out += buf;
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+using RAJA::util::detail::csv_escape;
+
+void write_stats_row(std::ofstream& csv,
+                     const std::string& name,
+                     const std::string& thread,
+                     const KernelStats& stats)
+{
+  csv << csv_escape(name) << ',' << thread << ',' << stats.count << ','
+      << stats.total << ',' << stats.min << ',' << stats.max << ','
+      << stats.total / static_cast<double>(stats.count) << '\n';
+}
+
+bool write_trace(TimingState& state,
+                 const std::string& filename,
+                 timing_clock::time_point epoch)
+{
+  std::ofstream json(filename);
+  if (!json) {
+    return false;
+  }
+
+  json << std::fixed << std::setprecision(3);
+  json << "{\"traceEvents\":[";
+  bool first = true;
+  size_t dropped_events = 0;
+  state.records.for_each([&](const ThreadRecord& record) {
+    // events only name kernels published before them
+    const size_t num_events = record.events.size();
+    std::vector<std::string> names;
+    for (size_t id = 0; id < record.kernels.size(); ++id) {
+      names.push_back(json_escape(record.kernels[id].name));
+    }
+    for (size_t i = 0; i < num_events; ++i) {
+      const TraceEvent& event = record.events[i];
+      const double ts =
+          std::chrono::duration<double, std::micro>(event.start - epoch)
+              .count();
+      const double dur =
+          std::chrono::duration<double, std::micro>(event.duration).count();
+      json << (first ? "\n" : ",\n") << "{\"name\":\"" << names[event.name]
+           << "\",\"cat\":\"RAJA\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+           << record.tid << ",\"ts\":" << ts << ",\"dur\":" << dur
+           << ",\"args\":{\"iterations\":" << event.num_iterations << "}}";
+      first = false;
+    }
+    dropped_events += record.dropped_events.load(std::memory_order_relaxed);
+  });
+  json << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":"
+       << dropped_events << "}}\n";
+
+  return static_cast<bool>(json);
+}
+
+bool write_summary(TimingState& state, const std::string& filename)
+{
+  std::ofstream csv(filename);
+  if (!csv) {
+    return false;
+  }
+
+  // per name the stats of each thread, names in order for stable output
+  std::map<std::string, std::vector<std::pair<int, KernelStats>>> kernels;
+  state.records.for_each([&](const ThreadRecord& record) {
+    const std::vector<KernelStats> stats =
+        snapshot_stats(record, record.kernels.size());
+    for (size_t id = 0; id < stats.size(); ++id) {
+      if (stats[id].count != 0) {
+        kernels[record.kernels[id].name].emplace_back(record.tid, stats[id]);
+      }
+    }
+  });
+
+  csv << std::scientific << std::setprecision(6);
+  csv << "kernel,thread,count,total_s,min_s,max_s,mean_s\n";
+  for (const auto& kernel : kernels) {
+    KernelStats all;
+    for (const auto& thread : kernel.second) {
+      write_stats_row(csv, kernel.first, std::to_string(thread.first),
+                      thread.second);
+      all.merge(thread.second);
+    }
+    write_stats_row(csv, kernel.first, "all", all);
+  }
+
+  return static_cast<bool>(csv);
+}
+
+}  // end anonymous namespace
+
+namespace RAJA {
+namespace util {
+
+TimingPlugin::TimingPlugin()
+  : Parent(forwarding_tag{})
+{
+  char* env = getenv("RAJA_TIMING_PLUGIN");
+  if (env != nullptr && env[0] != '\0') {
+    enable(std::string(env));
+  }
+}
+
+void TimingPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  TimingState& state = timing_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  get_thread_record(state)->starts.push_back(timing_clock::now());
+}
+
+void TimingPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  const timing_clock::time_point end = timing_clock::now();
+  TimingState& state = timing_state();
+  if (!state.enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  ThreadRecord* record = get_thread_record(state);
+  if (record->starts.empty()) {
+    // enabled while this kernel ran
+    return;
+  }
+  const timing_clock::time_point start = record->starts.back();
+  record->starts.pop_back();
+
+  const uint32_t id = static_cast<uint32_t>(record->stats.id(p.name()));
+  KernelStats& stats = record->stats.values[id];
+  stats.add(std::chrono::duration<double>(end - start).count());
+  if (id == record->kernels.size()) {
+    record->kernels.next().name = record->stats.names[id];
+    record->kernels.publish();
+  }
+  const unsigned sequence = record->sequence.load(std::memory_order_relaxed);
+  record->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  record->kernels[id].store(stats);
+  record->sequence.store(sequence + 2, std::memory_order_release);
+
+  if (record->events.size() <
+      state.max_events.load(std::memory_order_relaxed)) {
+    record->events.next() =
+        TraceEvent{id, p.num_iterations, start, end - start};
+    record->events.publish();
+  } else {
+    record->dropped_events.store(
+        record->dropped_events.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+  }
+}
+
+void TimingPlugin::finalize()
+{
+  if (enabled()) {
+    write();
+    disable();
+  }
+}
+
+void TimingPlugin::enable(const std::string& prefix, size_t max_events)
+{
+  TimingState& state = timing_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.records.clear();
+  state.prefix = prefix;
+  state.max_events.store(max_events, std::memory_order_relaxed);
+  state.epoch = timing_clock::now();
+  if (!state.enabled.exchange(true)) {
+    add_active_plugins(1);
+  }
+}
+
+void TimingPlugin::disable()
+{
+  TimingState& state = timing_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  if (state.enabled.exchange(false)) {
+    add_active_plugins(-1);
+  }
+  state.records.clear();
+}
+
+bool TimingPlugin::enabled()
+{
+  return timing_state().enabled.load(std::memory_order_relaxed);
+}
+
+bool TimingPlugin::write()
+{
+  TimingState& state = timing_state();
+  std::lock_guard<std::mutex> lock(state.mutex);
+
+  bool written = true;
+  const std::string trace_file = state.prefix + ".json";
+  if (!write_trace(state, trace_file, state.epoch)) {
+    printf("[TimingPlugin]: could not write %s\n", trace_file.c_str());
+    written = false;
+  }
+  const std::string summary_file = state.prefix + ".csv";
+  if (!write_summary(state, summary_file)) {
+    printf("[TimingPlugin]: could not write %s\n", summary_file.c_str());
+    written = false;
+  }
+  return written;
+}
+
+void linkTimingPlugin() {}
+
+}  // end namespace util
+}  // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::TimingPlugin> P(
+    "TimingPlugin",
+    "Time kernels per thread, write a Chrome trace and a CSV summary.");
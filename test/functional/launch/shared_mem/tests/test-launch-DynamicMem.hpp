@@ -40,7 +40,11 @@ void LaunchDynamicMemTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
     }
   }
 
-  size_t shared_mem_size = RAJA::stripIndexType(thread_range)*sizeof(INDEX_TYPE);
+  // a char array followed by the tile, padded so the tile is aligned
+  constexpr size_t tile_align = alignof(INDEX_TYPE);
+  size_t flags_size = RAJA::stripIndexType(thread_range)*sizeof(char);
+  size_t shared_mem_size = (flags_size + tile_align - 1) / tile_align * tile_align +
+                           RAJA::stripIndexType(thread_range)*sizeof(INDEX_TYPE);
 
   RAJA::launch<LAUNCH_POLICY>
     (RAJA::LaunchParams(RAJA::Teams(RAJA::stripIndexType(block_range)),
@@ -49,10 +53,12 @@ void LaunchDynamicMemTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
 
       RAJA::loop<TEAM_POLICY>(ctx, outer_range, [&](INDEX_TYPE bid) {
 
+          char * flags = ctx.getSharedMemory<char>(RAJA::stripIndexType(thread_range));
           INDEX_TYPE * tile_ptr = ctx.getSharedMemory<INDEX_TYPE>(RAJA::stripIndexType(thread_range));
           RAJA::View<INDEX_TYPE, RAJA::Layout<1>> Tile(tile_ptr, RAJA::stripIndexType(thread_range));
 
           RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
+              flags[RAJA::stripIndexType(thread_range)-RAJA::stripIndexType(tid)-1] = 1;
               Tile(RAJA::stripIndexType(thread_range)-RAJA::stripIndexType(tid)-1) = thread_range-tid-1 + thread_range*bid;
             });
 
@@ -60,7 +66,8 @@ void LaunchDynamicMemTestImpl(INDEX_TYPE block_range, INDEX_TYPE thread_range)
 
           RAJA::loop<THREAD_POLICY>(ctx, inner_range, [&](INDEX_TYPE tid) {
               INDEX_TYPE idx = tid + thread_range * bid;
-              working_array[RAJA::stripIndexType(idx)] = Tile(RAJA::stripIndexType(tid));
+              working_array[RAJA::stripIndexType(idx)] =
+                  (flags[RAJA::stripIndexType(tid)] == 1) ? Tile(RAJA::stripIndexType(tid)) : INDEX_TYPE(0);
           });
 
           ctx.releaseSharedMemory();
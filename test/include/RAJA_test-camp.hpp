@@ -26,6 +26,10 @@ using SequentialResourceList = HostResourceList;
 using OpenMPResourceList = HostResourceList;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolResourceList = HostResourceList;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaResourceList = camp::list<camp::resources::Cuda>;
 #endif
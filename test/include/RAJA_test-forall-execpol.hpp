@@ -15,6 +15,8 @@
 #include "RAJA/RAJA.hpp"
 #include "camp/list.hpp"
 
+#include "type_helper.hpp"
+
 // Sequential execution policy types
 using SequentialForallExecPols = camp::list< RAJA::seq_exec,
                                              RAJA::simd_exec >;
@@ -29,12 +31,27 @@ using SequentialForallReduceExecPols = camp::list< RAJA::seq_exec >;
 using SequentialForallAtomicExecPols = camp::list< RAJA::seq_exec >;
 
 #if defined(RAJA_ENABLE_OPENMP)
-using OpenMPForallExecPols = 
+//
+// OpenMP execution policy types for reduction tests.
+//
+// Note: the 'omp for simd' policies do not work with these, see
+//       OpenMPForallExecPols.
+//
+using OpenMPForallReduceExecPols = 
   camp::list< RAJA::omp_parallel_for_exec
  
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_work_stealing_exec< >
+              , RAJA::omp_work_stealing_exec<4>
+
+              , RAJA::omp_adaptive_exec< >
+              , RAJA::omp_adaptive_exec<16>
+
+              , RAJA::omp_parallel_for_static_placed_exec<RAJA::omp_proc_bind::spread>
+              , RAJA::omp_parallel_for_static_placed_exec<RAJA::omp_proc_bind::close, 2, 4>
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
@@ -70,7 +87,17 @@ using OpenMPForallExecPols =
 #endif       
              >;
 
-using OpenMPForallReduceExecPols = OpenMPForallExecPols;
+using OpenMPForallExecPols =
+  tt::concat_t< OpenMPForallReduceExecPols,
+                camp::list< RAJA::omp_parallel_for_simd_exec
+                          , RAJA::omp_parallel_for_simd_static_exec< >
+                          , RAJA::omp_parallel_for_simd_static_exec<4>
+
+#if defined(RAJA_TEST_EXHAUSTIVE)
+                          , RAJA::omp_parallel_exec<RAJA::omp_for_simd_exec>
+                          , RAJA::omp_parallel_exec<RAJA::omp_for_simd_static_exec<16, 4>>
+#endif
+                          > >;
 
 using OpenMPForallAtomicExecPols =
   camp::list< RAJA::omp_parallel_for_exec
@@ -93,6 +120,14 @@ using OpenMPForallAtomicExecPols =
 
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolForallExecPols = camp::list< RAJA::thread_pool_exec >;
+
+using ThreadPoolForallReduceExecPols = ThreadPoolForallExecPols;
+
+using ThreadPoolForallAtomicExecPols = ThreadPoolForallExecPols;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetForallExecPols =
   camp::list< RAJA::omp_target_parallel_for_exec<8>,
@@ -28,11 +28,22 @@ using SequentialForallIndexSetReduceExecPols =
 using OpenMPForallIndexSetExecPols =  
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
               RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::simd_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
+              RAJA::ExecPolicy<RAJA::omp_work_stealing_exec< >, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_work_stealing_exec< >> >;
 
 using OpenMPForallIndexSetReduceExecPols =
   camp::list< RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>,
-              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec> >;
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>,
+              RAJA::ExecPolicy<RAJA::omp_work_stealing_exec< >, RAJA::seq_exec> >;
+#endif
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolForallIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::thread_pool_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_pool_exec> >;
+
+using ThreadPoolForallIndexSetReduceExecPols = ThreadPoolForallIndexSetExecPols;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -24,8 +24,13 @@ using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
               RAJA::omp_reduce_ordered >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_reproducible >;
+#endif
 #endif
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolReducePols = camp::list< RAJA::thread_pool_reduce >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -8,6 +8,7 @@
 
 #include "gtest/gtest.h"
 
+#include <cstring>
 #include <iostream>
 
 #include "counter.hpp"
@@ -26,6 +27,7 @@ class CounterPlugin :
     ASSERT_EQ(data.capture_platform_active, RAJA::Platform::undefined);
     data.capture_counter_pre++;
     data.capture_platform_active = p.platform;
+    data.capture_num_iterations = p.num_iterations;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -54,6 +56,17 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_num_iterations = p.num_iterations;
+    data.launch_bytes_per_iteration = p.bytes_per_iteration;
+    data.launch_flops_per_iteration = p.flops_per_iteration;
+    data.launch_kernel_named = p.kernel_name != nullptr &&
+        std::strcmp(p.kernel_name, RAJA_PLUGIN_TEST_KERNEL_NAME) == 0;
+    data.launch_policy_named = p.policy_name != nullptr &&
+        std::strlen(p.policy_name) > 0;
+    for (int d = 0; d < 3; ++d) {
+      data.launch_teams[d] = p.teams[d];
+      data.launch_threads[d] = p.threads[d];
+    }
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -13,11 +13,24 @@ struct CounterData
   RAJA::Platform capture_platform_active = RAJA::Platform::undefined;
   int            capture_counter_pre     = 0;
   int            capture_counter_post    = 0;
+  // context of the last capture
+  long long      capture_num_iterations  = -1;
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  // context of the last launch
+  long long      launch_num_iterations  = -1;
+  double         launch_bytes_per_iteration = 0.0;
+  double         launch_flops_per_iteration = 0.0;
+  int            launch_kernel_named    = 0;
+  int            launch_policy_named    = 0;
+  int            launch_teams[3]        = {0, 0, 0};
+  int            launch_threads[3]      = {0, 0, 0};
 };
 
+// name given to kernels that check the context passed to plugins
+#define RAJA_PLUGIN_TEST_KERNEL_NAME "plugin-test-kernel"
+
 // note the use of a pointer here to allow different types of memory
 // to be used
 extern CounterData* plugin_test_data;
@@ -192,6 +192,53 @@ void PluginForAllIcountIdxSetTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// test that the context passed to the plugin describes the forall
+template <typename ExecPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginForallContextTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  for (int i = 0; i < 10; i++) {
+
+    RAJA::forall<ExecPolicy>(
+      WORKING_RES::get_default(),
+      RAJA::RangeSegment(0,i+1),
+      RAJA::expt::KernelName(RAJA_PLUGIN_TEST_KERNEL_NAME),
+      RAJA::expt::KernelCost(16.0, 2.0),
+      PluginTestCallable{data}
+    );
+
+    CounterData plugin_data;
+    plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+    ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(plugin_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(plugin_data.launch_num_iterations,  i+1);
+    ASSERT_EQ(plugin_data.launch_bytes_per_iteration, 16.0);
+    ASSERT_EQ(plugin_data.launch_flops_per_iteration, 2.0);
+    ASSERT_EQ(plugin_data.launch_kernel_named,    1);
+    ASSERT_EQ(plugin_data.launch_policy_named,    1);
+  }
+
+  // contexts without params have no name or cost
+  RAJA::forall<ExecPolicy>(
+    RAJA::RangeSegment(0,5),
+    PluginTestCallable{data}
+  );
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_num_iterations,  5);
+  ASSERT_EQ(plugin_data.launch_bytes_per_iteration, 0.0);
+  ASSERT_EQ(plugin_data.launch_kernel_named,    0);
+  ASSERT_EQ(plugin_data.launch_policy_named,    1);
+
+  plugin_test_resource->deallocate(data);
+}
+
 TYPED_TEST_SUITE_P(PluginForallTest);
 template <typename T>
 class PluginForallTest : public ::testing::Test
@@ -234,8 +281,18 @@ TYPED_TEST_P(PluginForallTest, PluginForAllIcountIdxSet)
   PluginForAllIcountIdxSetTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginForallTest, PluginForallContext)
+{
+  using ExecPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginForallContextTestImpl<ExecPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginForallTest,
                             PluginForall,
+                            PluginForallContext,
                             PluginForAllICount,
                             PluginForAllIdxSet,
                             PluginForAllIcountIdxSet);
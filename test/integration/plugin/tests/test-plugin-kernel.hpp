@@ -59,6 +59,70 @@ void PluginKernelTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// Check the context passed to the plugin by kernel_param.
+// KernelName and KernelCost are members of the param tuple so the lambda
+// receives them as arguments.
+template <typename KernelPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginKernelContextTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  CounterData* data = plugin_test_resource->allocate<CounterData>(10);
+
+  for (int i = 0; i < 10; i++) {
+
+    //Keep PluginTestCallable within a scope to ensure
+    //destruction, consistent with other test
+    {
+      PluginTestCallable p_callable{data};
+
+      RAJA::kernel_param<KernelPolicy>(
+        RAJA::make_tuple(RAJA::RangeSegment(0,i+1)),
+        RAJA::make_tuple(RAJA::expt::KernelName(RAJA_PLUGIN_TEST_KERNEL_NAME),
+                         RAJA::expt::KernelCost(16.0, 2.0)),
+        [=] RAJA_HOST_DEVICE (int idx,
+                              RAJA::expt::KernelName& RAJA_UNUSED_ARG(name),
+                              RAJA::expt::KernelCost& RAJA_UNUSED_ARG(cost))
+        {
+          p_callable(idx);
+        }
+      );
+    }
+
+    CounterData plugin_data;
+    plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+    ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(plugin_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(plugin_data.capture_num_iterations, i+1);
+    ASSERT_EQ(plugin_data.launch_num_iterations,  i+1);
+    ASSERT_EQ(plugin_data.launch_bytes_per_iteration, 16.0);
+    ASSERT_EQ(plugin_data.launch_flops_per_iteration, 2.0);
+    ASSERT_EQ(plugin_data.launch_kernel_named,    1);
+    ASSERT_EQ(plugin_data.launch_policy_named,    1);
+    for (int d = 0; d < 3; ++d) {
+      ASSERT_EQ(plugin_data.launch_teams[d],   0);
+      ASSERT_EQ(plugin_data.launch_threads[d], 0);
+    }
+  }
+
+  // contexts without params have no name or cost
+  RAJA::kernel<KernelPolicy>(
+    RAJA::make_tuple(RAJA::RangeSegment(0,5)),
+    PluginTestCallable{data}
+  );
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_num_iterations,  5);
+  ASSERT_EQ(plugin_data.launch_bytes_per_iteration, 0.0);
+  ASSERT_EQ(plugin_data.launch_kernel_named,    0);
+  ASSERT_EQ(plugin_data.launch_policy_named,    1);
+
+  plugin_test_resource->deallocate(data);
+}
+
 
 TYPED_TEST_SUITE_P(PluginKernelTest);
 template <typename T>
@@ -75,7 +139,17 @@ TYPED_TEST_P(PluginKernelTest, PluginKernel)
   PluginKernelTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginKernelTest, PluginKernelContext)
+{
+  using KernelPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginKernelContextTestImpl<KernelPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginKernelTest,
-                            PluginKernel);
+                            PluginKernel,
+                            PluginKernelContext);
 
 #endif  //__TEST_PLUGIN_KERNEL_HPP__
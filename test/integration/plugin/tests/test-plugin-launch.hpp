@@ -67,6 +67,54 @@ void PluginLaunchTestImpl()
   plugin_test_resource->deallocate(data);
 }
 
+// Check the context passed to the plugin by launch.
+template <typename LaunchPolicy,
+          typename WORKING_RES,
+          RAJA::Platform PLATFORM>
+void PluginLaunchContextTestImpl()
+{
+  SetupPluginVars spv(WORKING_RES::get_default());
+
+  for (int i = 0; i < 4; i++) {
+
+    RAJA::launch<LaunchPolicy>
+      (RAJA::LaunchParams(RAJA::Teams(i+1, 2), RAJA::Threads(3)),
+       RAJA_PLUGIN_TEST_KERNEL_NAME,
+       [=] RAJA_HOST_DEVICE(RAJA::LaunchContext RAJA_UNUSED_ARG(ctx))
+       {
+       });
+
+    CounterData plugin_data;
+    plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+    ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
+    ASSERT_EQ(plugin_data.launch_counter_pre,     i+1);
+    ASSERT_EQ(plugin_data.launch_counter_post,    i+1);
+    ASSERT_EQ(plugin_data.launch_teams[0],   i+1);
+    ASSERT_EQ(plugin_data.launch_teams[1],   2);
+    ASSERT_EQ(plugin_data.launch_teams[2],   1);
+    ASSERT_EQ(plugin_data.launch_threads[0], 3);
+    ASSERT_EQ(plugin_data.launch_threads[1], 1);
+    ASSERT_EQ(plugin_data.launch_threads[2], 1);
+    // each thread of each team counts as an iteration
+    ASSERT_EQ(plugin_data.launch_num_iterations, (i+1)*2*3);
+    ASSERT_EQ(plugin_data.launch_kernel_named,   1);
+    ASSERT_EQ(plugin_data.launch_policy_named,   1);
+  }
+
+  // launches without a name fall back to the policy name
+  RAJA::launch<LaunchPolicy>
+    (RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(1)),
+     [=] RAJA_HOST_DEVICE(RAJA::LaunchContext RAJA_UNUSED_ARG(ctx))
+     {
+     });
+
+  CounterData plugin_data;
+  plugin_test_resource->memcpy(&plugin_data, plugin_test_data, sizeof(CounterData));
+  ASSERT_EQ(plugin_data.launch_num_iterations, 1);
+  ASSERT_EQ(plugin_data.launch_kernel_named,   0);
+  ASSERT_EQ(plugin_data.launch_policy_named,   1);
+}
+
 
 TYPED_TEST_SUITE_P(PluginLaunchTest);
 template <typename T>
@@ -83,7 +131,17 @@ TYPED_TEST_P(PluginLaunchTest, PluginLaunch)
   PluginLaunchTestImpl<LaunchPolicy, ResType, PlatformHolder::platform>( );
 }
 
+TYPED_TEST_P(PluginLaunchTest, PluginLaunchContext)
+{
+  using LaunchPolicy = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType = typename camp::at<TypeParam, camp::num<1>>::type;
+  using PlatformHolder = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  PluginLaunchContextTestImpl<LaunchPolicy, ResType, PlatformHolder::platform>( );
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PluginLaunchTest,
-                            PluginLaunch);
+                            PluginLaunch,
+                            PluginLaunchContext);
 
 #endif  //__TEST_PLUGIN_LAUNCH_HPP__
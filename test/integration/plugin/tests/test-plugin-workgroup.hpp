@@ -90,6 +90,8 @@ void operator()() const
     ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
     ASSERT_EQ(plugin_data.launch_counter_pre,     0);
     ASSERT_EQ(plugin_data.launch_counter_post,    0);
+    // each enqueue reports the length of its own loop
+    ASSERT_EQ(plugin_data.capture_num_iterations, 1);
   }
 
   {
@@ -144,6 +146,10 @@ void operator()() const
     ASSERT_EQ(plugin_data.launch_platform_active, RAJA::Platform::undefined);
     ASSERT_EQ(plugin_data.launch_counter_pre,     1);
     ASSERT_EQ(plugin_data.launch_counter_post,    1);
+    // run reports the total length of the loops in the group
+    ASSERT_EQ(plugin_data.launch_num_iterations,  10);
+    ASSERT_EQ(plugin_data.launch_kernel_named,    0);
+    ASSERT_EQ(plugin_data.launch_policy_named,    1);
   }
 
   {
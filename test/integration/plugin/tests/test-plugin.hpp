@@ -38,9 +38,19 @@ struct SetupPluginVars
     data.capture_platform_active = RAJA::Platform::undefined;
     data.capture_counter_pre     = 0;
     data.capture_counter_post    = 0;
+    data.capture_num_iterations  = -1;
     data.launch_platform_active = RAJA::Platform::undefined;
     data.launch_counter_pre     = 0;
     data.launch_counter_post    = 0;
+    data.launch_num_iterations  = -1;
+    data.launch_bytes_per_iteration = 0.0;
+    data.launch_flops_per_iteration = 0.0;
+    data.launch_kernel_named    = 0;
+    data.launch_policy_named    = 0;
+    for (int d = 0; d < 3; ++d) {
+      data.launch_teams[d]   = 0;
+      data.launch_threads[d] = 0;
+    }
 
     m_test_resource.memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using RAJA::util::PerfCounterPlugin;
+
+static std::vector<std::string> split_csv_row(const std::string& row)
+{
+  // kernel names in these tests have no commas or quotes
+  std::vector<std::string> fields;
+  std::stringstream ss(row);
+  for (std::string field; std::getline(ss, field, ',');) {
+    fields.push_back(field);
+  }
+  if (!row.empty() && row.back() == ',') {
+    fields.push_back("");
+  }
+  return fields;
+}
+
+TEST(PluginTestPerfCounters, Report)
+{
+  const std::string prefix = "test-plugin-perf-counters";
+  PerfCounterPlugin::enable(prefix);
+  ASSERT_TRUE(RAJA::util::plugins_active());
+
+  const int N = 1 << 20;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+  for (int rep = 0; rep < 4; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                 RAJA::expt::KernelName("scale"),
+                                 [=](int i) { px[i] *= 1.5; });
+  }
+
+  RAJA::util::finalize_plugins();
+  ASSERT_FALSE(PerfCounterPlugin::enabled());
+  ASSERT_FALSE(RAJA::util::plugins_active());
+
+  std::ifstream csv(prefix + ".csv");
+  std::string header;
+  std::getline(csv, header);
+  ASSERT_EQ(header,
+            "kernel,count,cycles,instructions,llc_misses,branch_misses,"
+            "task_clock_ns,page_faults,ipc");
+
+  std::string row;
+  std::getline(csv, row);
+  std::vector<std::string> fields = split_csv_row(row);
+  ASSERT_EQ(fields.size(), 2u + PerfCounterPlugin::num_counters + 1u);
+  ASSERT_EQ(fields[0], "\"scale\"");
+  ASSERT_EQ(fields[1], "4");
+
+  // counters that can not be opened are left empty
+  for (int c = 0; c < PerfCounterPlugin::num_counters; ++c) {
+    const auto counter = static_cast<PerfCounterPlugin::counter>(c);
+    ASSERT_EQ(fields[2 + c].empty(), !PerfCounterPlugin::available(counter))
+        << PerfCounterPlugin::name(counter);
+  }
+  if (PerfCounterPlugin::available(PerfCounterPlugin::instructions)) {
+    ASSERT_GT(std::stoll(fields[2 + PerfCounterPlugin::instructions]), N);
+  }
+  if (PerfCounterPlugin::available(PerfCounterPlugin::task_clock_ns)) {
+    ASSERT_GT(std::stoll(fields[2 + PerfCounterPlugin::task_clock_ns]), 0);
+  }
+
+  std::remove((prefix + ".csv").c_str());
+}
+
+TEST(PluginTestPerfCounters, TeamThreads)
+{
+  const std::string prefix = "test-plugin-perf-counters-team";
+  PerfCounterPlugin::enable(prefix);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  using exec_policy = RAJA::omp_parallel_for_exec;
+#else
+  using exec_policy = RAJA::seq_exec;
+#endif
+
+  // every thread of the team adds its counts, only the launch is counted
+  const int N = 1 << 20;
+  std::vector<double> x(N, 1.0);
+  double* px = x.data();
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<exec_policy>(RAJA::RangeSegment(0, N),
+                              RAJA::expt::KernelName("team"),
+                              [=](int i) { px[i] += 1.0; });
+  }
+
+  ASSERT_TRUE(PerfCounterPlugin::write());
+  PerfCounterPlugin::disable();
+
+  std::ifstream csv(prefix + ".csv");
+  std::string row;
+  std::getline(csv, row);
+  std::getline(csv, row);
+  std::vector<std::string> fields = split_csv_row(row);
+  ASSERT_EQ(fields.size(), 2u + PerfCounterPlugin::num_counters + 1u);
+  ASSERT_EQ(fields[0], "\"team\"");
+  ASSERT_EQ(fields[1], "3");
+  if (PerfCounterPlugin::available(PerfCounterPlugin::instructions)) {
+    ASSERT_GT(std::stoll(fields[2 + PerfCounterPlugin::instructions]), N);
+  }
+
+  std::remove((prefix + ".csv").c_str());
+}
@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(PluginTestRoofline, Calibrate)
+{
+  const double peak = RAJA::util::RooflinePlugin::calibrate(1 << 20);
+  ASSERT_GT(peak, 0.0);
+  ASSERT_EQ(RAJA::util::RooflinePlugin::peak_bandwidth(), peak);
+}
+
+TEST(PluginTestRoofline, Report)
+{
+  const std::string prefix = "test-plugin-roofline";
+  RAJA::util::RooflinePlugin::set_peak_bandwidth(1.0e9);
+  RAJA::util::RooflinePlugin::set_peak_flops(2.0e9);
+  RAJA::util::RooflinePlugin::enable(prefix);
+  ASSERT_TRUE(RAJA::util::plugins_active());
+
+  const int N = 100000;
+  std::vector<double> x(N, 1.0);
+  std::vector<double> y(N, 2.0);
+  double* px = x.data();
+  double* py = y.data();
+  for (int rep = 0; rep < 3; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                                 RAJA::expt::KernelName("daxpy"),
+                                 RAJA::expt::KernelCost(3 * sizeof(double), 2),
+                                 [=](int i) { py[i] += 0.5 * px[i]; });
+  }
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, N),
+                               RAJA::expt::KernelName("no-cost"),
+                               [=](int i) { py[i] *= 0.5; });
+
+  RAJA::util::finalize_plugins();
+  ASSERT_FALSE(RAJA::util::RooflinePlugin::enabled());
+  ASSERT_FALSE(RAJA::util::plugins_active());
+
+  std::ifstream csv(prefix + ".csv");
+  std::string header;
+  std::getline(csv, header);
+  ASSERT_EQ(header.find("kernel,count,total_s,bytes,flops,GB_per_s,"), 0u);
+
+  std::vector<std::string> rows;
+  for (std::string row; std::getline(csv, row);) {
+    rows.push_back(row);
+  }
+  ASSERT_EQ(rows.size(), 2u);
+
+  std::string daxpy;
+  std::string no_cost;
+  for (const std::string& row : rows) {
+    if (row.find("\"daxpy\",") == 0) {
+      daxpy = row;
+    } else if (row.find("\"no-cost\",") == 0) {
+      no_cost = row;
+    }
+  }
+
+  // 3 runs of N iterations of 24 bytes and 2 flops
+  ASSERT_EQ(daxpy.find("\"daxpy\",3,"), 0u);
+  ASSERT_NE(daxpy.find(",7.200000e+06,6.000000e+05,"), std::string::npos);
+  ASSERT_NE(daxpy.find(",8.333333e-02,"), std::string::npos);
+  ASSERT_NE(daxpy.find(",1.000000e+00,2.000000e+00"), std::string::npos);
+
+  // no rates without a declared cost
+  ASSERT_EQ(no_cost.find("\"no-cost\",1,"), 0u);
+  ASSERT_NE(no_cost.find(",,,,,"), std::string::npos);
+
+  std::remove((prefix + ".csv").c_str());
+}
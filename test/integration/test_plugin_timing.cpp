@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string read_file(const std::string& filename)
+{
+  std::ifstream file(filename);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+static size_t count_substr(const std::string& s, const std::string& sub)
+{
+  size_t count = 0;
+  for (size_t pos = s.find(sub); pos != std::string::npos;
+       pos = s.find(sub, pos + sub.size())) {
+    ++count;
+  }
+  return count;
+}
+
+TEST(PluginTestTiming, DisabledByDefault)
+{
+  ASSERT_FALSE(RAJA::util::TimingPlugin::enabled());
+  ASSERT_FALSE(RAJA::util::plugins_active());
+}
+
+TEST(PluginTestTiming, ChromeTraceAndSummary)
+{
+  const std::string prefix = "test-plugin-timing";
+  std::remove((prefix + ".json").c_str());
+  std::remove((prefix + ".csv").c_str());
+
+  RAJA::util::TimingPlugin::enable(prefix);
+  ASSERT_TRUE(RAJA::util::plugins_active());
+
+  std::vector<double> a(1000, 1.0);
+  double* data = a.data();
+  for (int rep = 0; rep < 5; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 1000),
+                                 RAJA::expt::KernelName("scale"),
+                                 [=](int i) {
+                                   data[i] *= 2.0;
+                                 });
+  }
+
+  // other threads record into their own buffers
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 3; ++t) {
+    threads.emplace_back([=]() {
+      for (int rep = 0; rep < 4; ++rep) {
+        RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                     RAJA::expt::KernelName("axpy,\"quoted\""),
+                                     [=](int) {});
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  RAJA::util::finalize_plugins();
+  ASSERT_FALSE(RAJA::util::TimingPlugin::enabled());
+  ASSERT_FALSE(RAJA::util::plugins_active());
+
+  const std::string trace = read_file(prefix + ".json");
+  ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u);
+  ASSERT_EQ(count_substr(trace, "\"ph\":\"X\""), 17u);
+  ASSERT_EQ(count_substr(trace, "\"name\":\"scale\""), 5u);
+  ASSERT_EQ(count_substr(trace, "\"name\":\"axpy,\\\"quoted\\\"\""), 12u);
+  ASSERT_EQ(count_substr(trace, "\"iterations\":1000"), 5u);
+  ASSERT_NE(trace.find("\"dropped_events\":0"), std::string::npos);
+
+  const std::string summary = read_file(prefix + ".csv");
+  ASSERT_EQ(summary.find("kernel,thread,count,total_s,min_s,max_s,mean_s\n"),
+            0u);
+  ASSERT_NE(summary.find("\"scale\",0,5,"), std::string::npos);
+  ASSERT_NE(summary.find("\"scale\",all,5,"), std::string::npos);
+  ASSERT_EQ(count_substr(summary, "\"axpy,\"\"quoted\"\"\","), 4u);
+  ASSERT_NE(summary.find("\"axpy,\"\"quoted\"\"\",all,12,"),
+            std::string::npos);
+
+  // nothing is recorded once finalized
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10), [=](int) {});
+  std::remove((prefix + ".json").c_str());
+  RAJA::util::finalize_plugins();
+  ASSERT_TRUE(read_file(prefix + ".json").empty());
+
+  std::remove((prefix + ".csv").c_str());
+}
+
+TEST(PluginTestTiming, MaxEvents)
+{
+  const std::string prefix = "test-plugin-timing-max";
+
+  RAJA::util::TimingPlugin::enable(prefix, 3);
+  for (int rep = 0; rep < 10; ++rep) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10), [=](int) {});
+  }
+  ASSERT_TRUE(RAJA::util::TimingPlugin::write());
+  RAJA::util::TimingPlugin::disable();
+
+  const std::string trace = read_file(prefix + ".json");
+  ASSERT_EQ(count_substr(trace, "\"ph\":\"X\""), 3u);
+  ASSERT_NE(trace.find("\"dropped_events\":7"), std::string::npos);
+
+  // kernels without a name are summarized under their policy
+  const std::string summary = read_file(prefix + ".csv");
+  ASSERT_NE(summary.find("seq_exec"), std::string::npos);
+  ASSERT_NE(summary.find(",all,10,"), std::string::npos);
+
+  std::remove((prefix + ".json").c_str());
+  std::remove((prefix + ".csv").c_str());
+}
+
+TEST(PluginTestTiming, EnableWhileRunning)
+{
+  const std::string prefix = "test-plugin-timing-running";
+
+  // threads keep running kernels while the records are written and dropped
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 3; ++t) {
+    threads.emplace_back([&]() {
+      while (!done.load()) {
+        RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                     RAJA::expt::KernelName("running"),
+                                     [=](int) {});
+      }
+    });
+  }
+  for (int rep = 0; rep < 20; ++rep) {
+    RAJA::util::TimingPlugin::enable(prefix, 16);
+    ASSERT_TRUE(RAJA::util::TimingPlugin::write());
+    RAJA::util::TimingPlugin::disable();
+  }
+  done = true;
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ASSERT_FALSE(RAJA::util::plugins_active());
+
+  std::remove((prefix + ".json").c_str());
+  std::remove((prefix + ".csv").c_str());
+}
@@ -0,0 +1,289 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing tests for the radix sort path of the host sorts,
+/// which is taken for arithmetic keys compared with RAJA::operators::less
+/// or RAJA::operators::greater.
+///
+
+#ifndef __TEST_ALGORITHM_RADIX_SORT_HPP__
+#define __TEST_ALGORITHM_RADIX_SORT_HPP__
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_test-camp.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+// long enough to take the radix sort path
+constexpr size_t radix_sort_test_size()
+{
+  return 4 * RAJA::detail::radix_sort_cutoff() + 17;
+}
+
+//
+// Order of floating point keys produced by the radix sort, NaN with the
+// sign bit set first, then numbers with -0.0 equal to 0.0, then NaN
+// without the sign bit.
+//
+template < typename T >
+bool radix_sort_float_less(T lhs, T rhs)
+{
+  auto nan_class = [](T val) {
+    return std::isnan(val) ? (std::signbit(val) ? -1 : 1) : 0;
+  };
+  const int lhs_class = nan_class(lhs);
+  const int rhs_class = nan_class(rhs);
+  if (lhs_class != rhs_class) {
+    return lhs_class < rhs_class;
+  }
+  return lhs_class == 0 && lhs < rhs;
+}
+
+template < typename T >
+std::vector<T> radix_sort_float_keys(size_t N, unsigned seed)
+{
+  const T special[] = { T(0), -T(0),
+                        std::numeric_limits<T>::infinity(),
+                        -std::numeric_limits<T>::infinity(),
+                        std::numeric_limits<T>::quiet_NaN(),
+                        std::copysign(std::numeric_limits<T>::quiet_NaN(), T(-1)),
+                        std::numeric_limits<T>::lowest(),
+                        std::numeric_limits<T>::max(),
+                        std::numeric_limits<T>::denorm_min(),
+                        -std::numeric_limits<T>::denorm_min() };
+  constexpr size_t num_special = sizeof(special) / sizeof(special[0]);
+
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<T> dist(T(-100), T(100));
+  std::vector<T> keys(N);
+  for (size_t i = 0; i < N; ++i) {
+    // many repeats of the special values to check stability
+    keys[i] = (i % 5 == 0) ? special[(i / 5) % num_special] : dist(rng);
+  }
+  return keys;
+}
+
+//
+// Checks sort_pairs and stable_sort_pairs against std::stable_sort. The
+// values are the input positions, so they identify every key, including
+// -0.0 and 0.0 and NaN with either sign.
+//
+template < typename policy, typename T, typename Compare, typename RefLess >
+void radix_sort_check_pairs(std::vector<T> const& keys, Compare comp,
+                            RefLess ref_less)
+{
+  const size_t N = keys.size();
+
+  std::vector<size_t> expected(N);
+  for (size_t i = 0; i < N; ++i) {
+    expected[i] = i;
+  }
+  std::stable_sort(expected.begin(), expected.end(),
+                   [&](size_t lhs, size_t rhs) {
+                     return ref_less(keys[lhs], keys[rhs]);
+                   });
+
+  for (int stable = 0; stable < 2; ++stable) {
+    std::vector<T> sorted_keys(keys);
+    std::vector<size_t> sorted_vals(N);
+    for (size_t i = 0; i < N; ++i) {
+      sorted_vals[i] = i;
+    }
+
+    if (stable) {
+      RAJA::stable_sort_pairs<policy>(RAJA::make_span(sorted_keys.data(), N),
+                                      RAJA::make_span(sorted_vals.data(), N),
+                                      comp);
+    } else {
+      RAJA::sort_pairs<policy>(RAJA::make_span(sorted_keys.data(), N),
+                               RAJA::make_span(sorted_vals.data(), N),
+                               comp);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+      ASSERT_EQ(sorted_vals[i], expected[i]) << "stable " << stable
+                                             << " at " << i;
+      const T key = keys[expected[i]];
+      ASSERT_TRUE(std::memcmp(&sorted_keys[i], &key, sizeof(T)) == 0)
+          << "stable " << stable << " at " << i;
+    }
+  }
+}
+
+//
+// Checks sort and stable_sort of keys alone against std::stable_sort.
+//
+template < typename policy, typename T, typename Compare, typename RefLess >
+void radix_sort_check_keys(std::vector<T> const& keys, Compare comp,
+                           RefLess ref_less)
+{
+  const size_t N = keys.size();
+
+  std::vector<T> expected(keys);
+  std::stable_sort(expected.begin(), expected.end(), ref_less);
+
+  for (int stable = 0; stable < 2; ++stable) {
+    std::vector<T> sorted_keys(keys);
+
+    if (stable) {
+      RAJA::stable_sort<policy>(RAJA::make_span(sorted_keys.data(), N), comp);
+    } else {
+      RAJA::sort<policy>(RAJA::make_span(sorted_keys.data(), N), comp);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+      // -0.0 and 0.0 are equal so only stable sorts keep them in place
+      ASSERT_FALSE(ref_less(sorted_keys[i], expected[i]) ||
+                   ref_less(expected[i], sorted_keys[i]))
+          << "stable " << stable << " at " << i;
+      if (stable) {
+        ASSERT_TRUE(std::memcmp(&sorted_keys[i], &expected[i], sizeof(T)) == 0)
+            << "stable " << stable << " at " << i;
+      }
+    }
+  }
+}
+
+template < typename policy, typename T >
+void radix_sort_float_test()
+{
+  std::vector<T> keys = radix_sort_float_keys<T>(radix_sort_test_size(), 7u);
+
+  auto ref_less = [](T lhs, T rhs) { return radix_sort_float_less(lhs, rhs); };
+  auto ref_greater = [](T lhs, T rhs) { return radix_sort_float_less(rhs, lhs); };
+
+  radix_sort_check_keys<policy>(keys, RAJA::operators::less<T>{}, ref_less);
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::less<T>{}, ref_less);
+
+  radix_sort_check_keys<policy>(keys, RAJA::operators::greater<T>{}, ref_greater);
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::greater<T>{}, ref_greater);
+}
+
+template < typename policy, typename T >
+void radix_sort_integer_test()
+{
+  const T special[] = { std::numeric_limits<T>::min(),
+                        std::numeric_limits<T>::max(),
+                        T(std::numeric_limits<T>::min() + 1),
+                        T(std::numeric_limits<T>::max() - 1),
+                        T(0), T(1), T(-1) };
+  constexpr size_t num_special = sizeof(special) / sizeof(special[0]);
+
+  const size_t N = radix_sort_test_size();
+
+  std::mt19937 rng(11u);
+  std::uniform_int_distribution<long long> dist(
+      std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+  std::vector<T> keys(N);
+  for (size_t i = 0; i < N; ++i) {
+    keys[i] = (i % 3 == 0) ? special[(i / 3) % num_special] : T(dist(rng));
+  }
+
+  auto ref_less = [](T lhs, T rhs) { return lhs < rhs; };
+  auto ref_greater = [](T lhs, T rhs) { return rhs < lhs; };
+
+  radix_sort_check_keys<policy>(keys, RAJA::operators::less<T>{}, ref_less);
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::less<T>{}, ref_less);
+
+  radix_sort_check_keys<policy>(keys, RAJA::operators::greater<T>{}, ref_greater);
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::greater<T>{}, ref_greater);
+}
+
+
+template <typename T>
+class RadixSortUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(RadixSortUnitTest);
+
+TYPED_TEST_P(RadixSortUnitTest, FloatKeys)
+{
+  using policy = camp::at_v<TypeParam, 0>;
+  radix_sort_float_test<policy, float>();
+}
+
+TYPED_TEST_P(RadixSortUnitTest, DoubleKeys)
+{
+  using policy = camp::at_v<TypeParam, 0>;
+  radix_sort_float_test<policy, double>();
+}
+
+TYPED_TEST_P(RadixSortUnitTest, SignedIntLimits)
+{
+  using policy = camp::at_v<TypeParam, 0>;
+  radix_sort_integer_test<policy, int>();
+  radix_sort_integer_test<policy, long long>();
+  radix_sort_integer_test<policy, signed char>();
+}
+
+TYPED_TEST_P(RadixSortUnitTest, PairsStability)
+{
+  using policy = camp::at_v<TypeParam, 0>;
+
+  // few distinct keys so every key is repeated many times, and keys that
+  // only differ in the high digits so the low passes are skipped
+  const size_t N = radix_sort_test_size();
+  std::vector<unsigned> keys(N);
+  for (size_t i = 0; i < N; ++i) {
+    keys[i] = unsigned((i * 7919u) % 13u) << 24;
+  }
+
+  auto ref_less = [](unsigned lhs, unsigned rhs) { return lhs < rhs; };
+  auto ref_greater = [](unsigned lhs, unsigned rhs) { return rhs < lhs; };
+
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::less<unsigned>{}, ref_less);
+  radix_sort_check_pairs<policy>(keys, RAJA::operators::greater<unsigned>{}, ref_greater);
+}
+
+TYPED_TEST_P(RadixSortUnitTest, LargeSortScratch)
+{
+  using policy = camp::at_v<TypeParam, 0>;
+
+  // the key and value scratch of this sort is too large to take from the
+  // pool, so the pool must not keep memory of that size afterwards
+  const size_t N = 2 * RAJA::host_scratch_pool_max_bytes / sizeof(float) + 1;
+  std::vector<float> keys(N);
+  std::vector<unsigned> vals(N);
+  for (size_t i = 0; i < N; ++i) {
+    keys[i] = float((i * 7919u) % N) - float(N / 2);
+    vals[i] = unsigned(i);
+  }
+
+  RAJA::host_mempool_type& pool = RAJA::host_mempool_type::getInstance();
+  const RAJA::basic_mempool::MemPoolStatistics before = pool.statistics();
+
+  RAJA::stable_sort_pairs<policy>(RAJA::make_span(keys.data(), N),
+                                  RAJA::make_span(vals.data(), N),
+                                  RAJA::operators::less<float>{});
+
+  const RAJA::basic_mempool::MemPoolStatistics after = pool.statistics();
+
+  ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+  EXPECT_EQ(after.in_use_bytes(), before.in_use_bytes());
+  EXPECT_LT(after.arena_bytes - before.arena_bytes, N * sizeof(float));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(RadixSortUnitTest,
+                            FloatKeys,
+                            DoubleKeys,
+                            SignedIntLimits,
+                            PairsStability,
+                            LargeSortScratch);
+
+using SequentialRadixSortExecPols = camp::list< RAJA::seq_exec >;
+
+#if defined(RAJA_ENABLE_OPENMP)
+using OpenMPRadixSortExecPols = camp::list< RAJA::omp_parallel_for_exec >;
+#endif
+
+#endif // __TEST_ALGORITHM_RADIX_SORT_HPP__
@@ -99,6 +99,16 @@ using OpenMPSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+using ThreadPoolSortSorters =
+  camp::list<
+              PolicySort<RAJA::thread_pool_exec>,
+              PolicySortPairs<RAJA::thread_pool_exec>
+            >;
+
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaSortSorters =
@@ -99,6 +99,16 @@ using OpenMPStableSortSorters =
 
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+using ThreadPoolStableSortSorters =
+  camp::list<
+              PolicyStableSort<RAJA::thread_pool_exec>,
+              PolicyStableSortPairs<RAJA::thread_pool_exec>
+            >;
+
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaStableSortSorters =
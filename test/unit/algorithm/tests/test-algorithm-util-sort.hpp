@@ -57,6 +57,12 @@ struct MergeSort;
 template < typename test_policy, typename platform = test_platform<test_policy> >
 struct MergeSortPairs;
 
+template < typename test_policy, typename platform = test_platform<test_policy> >
+struct MergeSortNoWorkspace;
+
+template < typename test_policy, typename platform = test_platform<test_policy> >
+struct MergeSortNoWorkspacePairs;
+
 
 template < typename test_policy >
 struct InsertionSort<test_policy, RunOnHost>
@@ -283,6 +289,53 @@ struct MergeSortPairs<test_policy, RunOnHost>
   }
 };
 
+template < typename test_policy >
+struct MergeSortNoWorkspace<test_policy, RunOnHost>
+  : ForoneSynchronize<test_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::merge_sort[no workspace]";
+  }
+
+  template < typename Container,
+             typename Compare = RAJA::operators::less<RAJA::detail::ContainerRef<Container>>>
+  void operator()(Container&& c,
+                  Compare comp = Compare{})
+  {
+    RAJA::merge_sort(c, comp, nullptr);
+  }
+};
+
+template < typename test_policy >
+struct MergeSortNoWorkspacePairs<test_policy, RunOnHost>
+  : ForoneSynchronize<test_policy>
+{
+  using sort_category = stable_sort_tag;
+  using sort_interface = sort_pairs_interface_tag;
+  using supports_resource = std::false_type;
+
+  const char* name()
+  {
+    return "RAJA::merge_sort[no workspace][pairs]";
+  }
+
+  template < typename KeyContainer, typename ValContainer,
+             typename Compare = RAJA::operators::less<RAJA::detail::ContainerRef<KeyContainer>>>
+  void operator()(KeyContainer&& keys,
+                  ValContainer&& vals,
+                  Compare comp = Compare{})
+  {
+    auto c = RAJA::zip_span(keys, vals);
+    using zip_ref = RAJA::detail::ContainerRef<camp::decay<decltype(c)>>;
+    RAJA::merge_sort(c, RAJA::compare_first<zip_ref>(comp), nullptr);
+  }
+};
+
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP)
 
 template < typename test_policy >
@@ -663,6 +716,12 @@ using SequentialMergeSortSorters =
               MergeSortPairs<test_seq>
             >;
 
+using SequentialMergeNoWorkspaceSortSorters =
+  camp::list<
+              MergeSortNoWorkspace<test_seq>,
+              MergeSortNoWorkspacePairs<test_seq>
+            >;
+
 #if defined(RAJA_ENABLE_CUDA)
 
 using CudaInsertionSortSorters =
@@ -9,6 +9,9 @@
 /// Source file containing unit tests for IndexSet class.
 ///
 
+#include <algorithm>
+#include <vector>
+
 #include "RAJA_test-base.hpp"
 
 #include "camp/resource.hpp"
@@ -224,3 +227,148 @@ TEST(IndexSetUnitTest, ConditionalLessThan100Indices)
     EXPECT_EQ(lt100_indices[i], ref_lt100_indices[i]);
   }
 }
+
+TEST(IndexSetUnitTest, DependencyGraph)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+  RIndexSetType iset;
+  iset.push_back(RangeSegType(0, 4));
+  iset.push_back(RangeSegType(4, 8));
+  iset.push_back(RangeSegType(8, 12));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  iset.initDependencyGraph();
+  for (int seg = 0; seg < 3; ++seg) {
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(seg);
+    ASSERT_EQ(0, task->numDepTasks());
+    task->semaphoreValue() = (seg == 0) ? 0 : 1;
+    task->semaphoreReloadValue() = (seg == 0) ? 0 : 1;
+    if (seg != 2) {
+      task->numDepTasks() = 1;
+      task->depTaskNum(0) = seg + 1;
+    }
+  }
+  ASSERT_FALSE(iset.dependencyGraphSet());
+  iset.finalizeDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  ASSERT_EQ(0, iset.getDepGraphNode(1)->satisfyOne());
+  iset.getDepGraphNode(1)->reset();
+  ASSERT_EQ(1, iset.getDepGraphNode(1)->semaphoreValue());
+
+  RIndexSetType iset2(iset);
+  ASSERT_TRUE(iset2.dependencyGraphSet());
+  ASSERT_NE(iset.getDepGraphNode(0), iset2.getDepGraphNode(0));
+  ASSERT_EQ(1, iset2.getDepGraphNode(0)->numDepTasks());
+  ASSERT_EQ(1, iset2.getDepGraphNode(0)->depTaskNum(0));
+  ASSERT_EQ(1, iset2.getDepGraphNode(2)->semaphoreValue());
+
+  RIndexSetType iset3;
+  iset3.swap(iset2);
+  ASSERT_TRUE(iset3.dependencyGraphSet());
+  ASSERT_FALSE(iset2.dependencyGraphSet());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <typename SEG_ITER_POLICY>
+void runTaskGraphChain()
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+  // each segment reads the values written by the segment before it
+  constexpr int num_seg = 16;
+  constexpr int seg_len = 32;
+  RIndexSetType iset;
+  for (int seg = 0; seg < num_seg; ++seg) {
+    iset.push_back(RangeSegType(seg * seg_len, (seg + 1) * seg_len));
+    iset.setSegmentInterval(seg, seg, seg + 1);
+  }
+  iset.initDependencyGraph();
+  for (int seg = 0; seg < num_seg; ++seg) {
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(seg);
+    task->semaphoreValue() = (seg == 0) ? 0 : 1;
+    task->semaphoreReloadValue() = (seg == 0) ? 0 : 1;
+    if (seg != num_seg - 1) {
+      task->numDepTasks() = 1;
+      task->depTaskNum(0) = seg + 1;
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  std::vector<int> vals(num_seg * seg_len);
+  int* vals_ptr = vals.data();
+  for (int traversal = 0; traversal < 3; ++traversal) {
+    std::fill(vals.begin(), vals.end(), 0);
+
+    RAJA::forall<RAJA::ExecPolicy<SEG_ITER_POLICY, RAJA::seq_exec>>(
+        iset, [=](int i) {
+          vals_ptr[i] = (i < seg_len) ? 1 : vals_ptr[i - seg_len] + 1;
+        });
+
+    for (int i = 0; i < num_seg * seg_len; ++i) {
+      ASSERT_EQ(i / seg_len + 1, vals[i]);
+    }
+  }
+}
+
+TEST(IndexSetUnitTest, TaskGraphChain)
+{
+  runTaskGraphChain<RAJA::omp_taskgraph_segit>();
+  runTaskGraphChain<RAJA::omp_taskgraph_interval_segit>();
+}
+
+TEST(IndexSetUnitTest, TaskGraphPipelined)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+
+  // both segments are ready, segment 0 readies segment 1 for the next
+  // traversal, possibly while segment 1 still runs in this one
+  RIndexSetType iset;
+  iset.push_back(RangeSegType(0, 1));
+  iset.push_back(RangeSegType(1, 2));
+  iset.initDependencyGraph();
+  RAJA::DepGraphNode* first = iset.getDepGraphNode(0);
+  first->numDepTasks() = 1;
+  first->depTaskNum(0) = 1;
+  iset.getDepGraphNode(1)->semaphoreReloadValue() = 1;
+  iset.finalizeDependencyGraph();
+
+  int visits[2] = {0, 0};
+  int* visits_ptr = visits;
+  for (int traversal = 0; traversal < 4; ++traversal) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+        iset, [=](int i) { visits_ptr[i] += 1; });
+    ASSERT_EQ(0, iset.getDepGraphNode(1)->semaphoreValue());
+  }
+  ASSERT_EQ(4, visits[0]);
+  ASSERT_EQ(4, visits[1]);
+}
+
+TEST(IndexSetUnitTest, TaskGraphLockFreeBlock)
+{
+  constexpr int fast = 4;
+  constexpr int mid = 4;
+  constexpr int slow = 64;
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fast, mid, slow);
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(size_t(fast * mid * slow), iset.getLength());
+
+  std::vector<int> visits(fast * mid * slow, 0);
+  int* visits_ptr = visits.data();
+  for (int sweep = 0; sweep < 3; ++sweep) {
+    RAJA::forall<RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>(
+        iset, [=](int i) { visits_ptr[i] += 1; });
+    RAJA::forall<
+        RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::seq_exec>>(
+        iset, [=](int i) { visits_ptr[i] += 1; });
+  }
+
+  for (int i = 0; i < fast * mid * slow; ++i) {
+    ASSERT_EQ(6, visits[i]);
+  }
+}
+#endif
@@ -0,0 +1,239 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the static partition of the OpenMP
+/// static schedule policies, the thread placement policies and the
+/// 'omp for simd' policies
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+TEST(OpenMPStaticPartitionTest, Blocks)
+{
+  for (int num_threads = 1; num_threads <= 5; ++num_threads) {
+    for (long len = 0; len < 23; ++len) {
+      long next = 0;
+      for (int tid = 0; tid < num_threads; ++tid) {
+        long begin = -1;
+        long end = -1;
+        RAJA::policy::omp::internal::static_block(len, tid, num_threads,
+                                                  begin, end);
+        ASSERT_EQ(begin, next);
+        ASSERT_GE(end - begin, len / num_threads);
+        ASSERT_LE(end - begin, len / num_threads + 1);
+        next = end;
+      }
+      ASSERT_EQ(next, len);
+    }
+  }
+}
+
+template <typename ExecPol>
+static std::vector<int> owners(int len)
+{
+  std::vector<int> owner(len, -1);
+  int* o = owner.data();
+  RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, len),
+                        [=](int i) { o[i] = omp_get_thread_num(); });
+  return owner;
+}
+
+TEST(OpenMPStaticPartitionTest, SameBlocksAcrossLoops)
+{
+  // the team size, and so the blocks, may change when it is dynamic
+  if (omp_get_dynamic()) {
+    return;
+  }
+
+  const int len = 1001;
+  const std::vector<int> first = owners<RAJA::omp_parallel_for_static_exec<>>(len);
+  for (int i = 0; i < len; ++i) {
+    ASSERT_GE(first[i], 0);
+    if (i > 0) {
+      ASSERT_GE(first[i], first[i - 1]);
+    }
+  }
+
+  for (int rep = 0; rep < 3; ++rep) {
+    ASSERT_EQ(owners<RAJA::omp_parallel_for_static_exec<>>(len), first);
+    ASSERT_EQ(owners<RAJA::omp_parallel_for_static_placed_exec<
+                  RAJA::omp_proc_bind::close>>(len),
+              first);
+  }
+
+  const std::vector<int> chunked = owners<RAJA::omp_parallel_for_static_exec<4>>(len);
+  for (int rep = 0; rep < 3; ++rep) {
+    ASSERT_EQ(owners<RAJA::omp_parallel_for_static_exec<4>>(len), chunked);
+  }
+}
+
+TEST(OpenMPStaticPartitionTest, NumThreads)
+{
+  int team = 0;
+  int* t = &team;
+  RAJA::forall<RAJA::omp_parallel_for_static_placed_exec<
+      RAJA::omp_proc_bind::spread, 3>>(
+      RAJA::TypedRangeSegment<int>(0, 3), [=](int i) {
+        if (i == 0) {
+          *t = omp_get_num_threads();
+        }
+      });
+  if (!omp_get_dynamic()) {
+    ASSERT_EQ(team, 3);
+  }
+
+  int region_team = 0;
+  RAJA::region<RAJA::omp_parallel_placed_region<RAJA::omp_proc_bind::close, 2>>(
+      [&]() {
+        #pragma omp single
+        region_team = omp_get_num_threads();
+      });
+  if (!omp_get_dynamic()) {
+    ASSERT_EQ(region_team, 2);
+  }
+}
+
+TEST(OpenMPStaticPartitionTest, Reducers)
+{
+  const int len = 1000;
+  int sum = 0;
+  RAJA::forall<RAJA::omp_parallel_for_static_placed_exec<
+      RAJA::omp_proc_bind::close, 2, 8>>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+  ASSERT_EQ(sum, len * (len - 1) / 2);
+
+  sum = 0;
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+  ASSERT_EQ(sum, len * (len - 1) / 2);
+}
+
+TEST(OpenMPStaticPartitionTest, SimdBlocks)
+{
+  for (int num_threads = 1; num_threads <= 4; ++num_threads) {
+    for (long len = 0; len < 70; ++len) {
+      std::vector<int> count(len, 0);
+      std::vector<int> misaligned(num_threads, 0);
+      #pragma omp parallel num_threads(num_threads)
+      {
+        RAJA::policy::omp::internal::static_for_blocks<0, 8>(
+            len, [&](long b, long e) {
+              misaligned[omp_get_thread_num()] += (b % 8 != 0);
+              for (long i = b; i < e; ++i) {
+                ++count[i];
+              }
+            });
+        #pragma omp barrier
+        // a chunk of 3 is rounded up to 8
+        RAJA::policy::omp::internal::static_for_blocks<3, 8>(
+            len, [&](long b, long e) {
+              misaligned[omp_get_thread_num()] += (b % 8 != 0) + (e - b > 8);
+              for (long i = b; i < e; ++i) {
+                ++count[i];
+              }
+            });
+      }
+      for (long i = 0; i < len; ++i) {
+        ASSERT_EQ(count[i], 2);
+      }
+      for (int t = 0; t < num_threads; ++t) {
+        ASSERT_EQ(misaligned[t], 0);
+      }
+    }
+  }
+
+  // every thread's block of a forall starts on a multiple of SimdLen
+  const int len = 1001;
+  const std::vector<int> owner =
+      owners<RAJA::omp_parallel_for_simd_static_exec<>>(len);
+  for (int i = 1; i < len; ++i) {
+    ASSERT_GE(owner[i], 0);
+    if (owner[i] != owner[i - 1]) {
+      ASSERT_EQ(i % RAJA::policy::omp::default_simd_len, 0);
+    }
+  }
+}
+
+TEST(OpenMPStaticPartitionTest, SimdReducers)
+{
+  const int len = 1000;
+  int sum = 0;
+  RAJA::forall<RAJA::omp_parallel_for_simd_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+  ASSERT_EQ(sum, len * (len - 1) / 2);
+
+  sum = 0;
+  RAJA::forall<RAJA::omp_parallel_for_simd_static_exec<>>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+      [=](int i, int& s) { s += i; });
+  ASSERT_EQ(sum, len * (len - 1) / 2);
+
+  int max = 0;
+  RAJA::forall<RAJA::omp_parallel_for_simd_static_exec<16, 4>>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      RAJA::expt::Reduce<RAJA::operators::maximum>(&max),
+      [=](int i, int& m) { m = RAJA_MAX(m, i); });
+  ASSERT_EQ(max, len - 1);
+}
+
+template <typename LOOP_EXEC>
+void testSimdLaunch()
+{
+  const int len = 37;
+  std::vector<int> a(len, 0);
+  std::vector<int> b(len * len, 0);
+  int* pa = a.data();
+  int* pb = b.data();
+
+  using launch_pol = RAJA::LaunchPolicy<RAJA::omp_launch_t>;
+  using loop_pol = RAJA::LoopPolicy<LOOP_EXEC>;
+
+  RAJA::launch<launch_pol>(
+      RAJA::LaunchParams(), [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<loop_pol>(ctx, RAJA::TypedRangeSegment<int>(0, len),
+                             [&](int i) { pa[i] += i; });
+
+        RAJA::loop_icount<loop_pol>(ctx, RAJA::TypedRangeSegment<int>(1, len + 1),
+                                    [&](int i, int ii) { pa[ii] += i; });
+
+        RAJA::expt::loop<loop_pol>(
+            ctx,
+            RAJA::TypedRangeSegment<int>(0, len),
+            RAJA::TypedRangeSegment<int>(0, len),
+            [&](int i, int j) { pb[j * len + i] += i + j; });
+      });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(a[i], 2 * i + 1);
+    for (int j = 0; j < len; ++j) {
+      ASSERT_EQ(b[j * len + i], i + j);
+    }
+  }
+}
+
+TEST(OpenMPStaticPartitionTest, SimdLaunch)
+{
+  testSimdLaunch<RAJA::omp_for_simd_exec>();
+}
+
+TEST(OpenMPStaticPartitionTest, SimdStaticLaunch)
+{
+  testSimdLaunch<RAJA::omp_for_simd_static_exec<>>();
+  testSimdLaunch<RAJA::omp_for_simd_static_exec<5, 4>>();
+}
@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA reproducible OpenMP reductions.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cmath>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+template <typename ExecPol>
+double reproducibleSum(std::vector<double> const& vals)
+{
+  const double* data = vals.data();
+  RAJA::ReduceSum<RAJA::omp_reduce_reproducible, double> sum(0.0);
+  RAJA::forall<ExecPol>(RAJA::TypedRangeSegment<int>(0, vals.size()),
+    [=](int i) {
+      sum += data[i];
+  });
+  return sum.get();
+}
+
+TEST(ReducerReproducibleUnitTest, ExactCancellation)
+{
+  // Every term of 1.0 is lost when summed in order in double precision
+  const int N = 3000;
+  std::vector<double> vals(N);
+  for (int i = 0; i < N; i += 3) {
+    vals[i] = 1.0e100;
+    vals[i+1] = 1.0;
+    vals[i+2] = -1.0e100;
+  }
+
+  ASSERT_EQ(reproducibleSum<RAJA::seq_exec>(vals), N / 3.0);
+  ASSERT_EQ(reproducibleSum<RAJA::omp_parallel_for_exec>(vals), N / 3.0);
+}
+
+TEST(ReducerReproducibleUnitTest, ThreadCountIndependent)
+{
+  const int N = 100003;
+  std::vector<double> vals(N);
+  for (int i = 0; i < N; ++i) {
+    vals[i] = std::sin(1.7 * i) * std::pow(10.0, (i % 17) - 8);
+  }
+
+  const double expected = reproducibleSum<RAJA::seq_exec>(vals);
+
+  ASSERT_EQ(reproducibleSum<RAJA::simd_exec>(vals), expected);
+
+  const int max_threads = omp_get_max_threads();
+  for (int nt = 1; nt <= max_threads; ++nt) {
+    omp_set_num_threads(nt);
+    ASSERT_EQ(reproducibleSum<RAJA::omp_parallel_for_exec>(vals), expected);
+    ASSERT_EQ(reproducibleSum<RAJA::omp_parallel_for_static_exec<7>>(vals),
+              expected);
+    ASSERT_EQ(reproducibleSum<RAJA::omp_parallel_for_dynamic_exec<13>>(vals),
+              expected);
+  }
+  omp_set_num_threads(max_threads);
+}
+
+TEST(ReducerReproducibleUnitTest, NonFinite)
+{
+  std::vector<double> vals{1.0, HUGE_VAL, 2.0};
+  ASSERT_EQ(reproducibleSum<RAJA::omp_parallel_for_exec>(vals), HUGE_VAL);
+
+  vals.push_back(-HUGE_VAL);
+  ASSERT_TRUE(std::isnan(reproducibleSum<RAJA::omp_parallel_for_exec>(vals)));
+}
+
+#endif
@@ -0,0 +1,143 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the AutoTuner and tuned_forall
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using RAJA::expt::AutoTuner;
+using RAJA::expt::TunedKernel;
+
+TEST(AutoTunerUnitTest, PicksFastest)
+{
+  AutoTuner& tuner = AutoTuner::getInstance();
+  tuner.reset();
+  tuner.file("");
+  const int old_trials = tuner.trials(2);
+
+  TunedKernel& k = tuner.kernel("picks-fastest", 1, 3, 0);
+  const double seconds[3] = {3.0, 1.0, 2.0};
+  for (int call = 0; call < 6; ++call) {
+    ASSERT_EQ(k.choice.load(), -1);
+    const int pol = tuner.next_policy(k);
+    ASSERT_EQ(pol, call % 3);
+    tuner.record(k, pol, seconds[pol]);
+  }
+  ASSERT_EQ(k.choice.load(), 1);
+  ASSERT_EQ(tuner.next_policy(k), 1);
+
+  // other lengths and policy lists are tuned on their own
+  ASSERT_EQ(tuner.kernel("picks-fastest", 1, 3, 1).choice.load(), -1);
+  ASSERT_EQ(tuner.kernel("picks-fastest", 2, 3, 0).choice.load(), -1);
+  ASSERT_EQ(&tuner.kernel("picks-fastest", 1, 3, 0), &k);
+
+  tuner.trials(old_trials);
+  tuner.reset();
+}
+
+TEST(AutoTunerUnitTest, ResetRetires)
+{
+  AutoTuner& tuner = AutoTuner::getInstance();
+  tuner.reset();
+  tuner.file("");
+  const int old_trials = tuner.trials(1);
+
+  // a kernel in use when reset is called stays valid and can still finish
+  TunedKernel& k = tuner.kernel("reset-retires", 1, 2, 0);
+  tuner.record(k, tuner.next_policy(k), 2.0);
+  tuner.reset();
+  tuner.record(k, tuner.next_policy(k), 1.0);
+  ASSERT_EQ(k.choice.load(), 1);
+
+  // but its choice is not kept
+  TunedKernel& fresh = tuner.kernel("reset-retires", 1, 2, 0);
+  ASSERT_NE(&fresh, &k);
+  ASSERT_EQ(fresh.choice.load(), -1);
+
+  tuner.trials(old_trials);
+  tuner.reset();
+}
+
+TEST(AutoTunerUnitTest, LengthClass)
+{
+  ASSERT_EQ(AutoTuner::length_class(0), 0);
+  ASSERT_EQ(AutoTuner::length_class(7), 0);
+  ASSERT_EQ(AutoTuner::length_class(8), 1);
+  ASSERT_EQ(AutoTuner::length_class(63), 1);
+  ASSERT_EQ(AutoTuner::length_class(64), 2);
+}
+
+TEST(AutoTunerUnitTest, TunedForall)
+{
+  using policies = camp::list<RAJA::seq_exec, RAJA::simd_exec>;
+
+  AutoTuner& tuner = AutoTuner::getInstance();
+  tuner.reset();
+  tuner.file("");
+  const int trials = tuner.trials();
+
+  const int N = 1000;
+  std::vector<int> x(N, 0);
+  int* px = x.data();
+  for (int call = 0; call < 2 * trials + 2; ++call) {
+    RAJA::expt::tuned_forall<policies>("tuned-forall",
+                                       RAJA::TypedRangeSegment<int>(0, N),
+                                       [=](int i) { px[i] += 1; });
+  }
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(x[i], 2 * trials + 2);
+  }
+
+  const uint64_t list_id =
+      AutoTuner::list_id(RAJA::util::detail::type_name<policies>());
+  TunedKernel& k =
+      tuner.kernel("tuned-forall", list_id, 2, AutoTuner::length_class(N));
+  ASSERT_GE(k.choice.load(), 0);
+  ASSERT_LT(k.choice.load(), 2);
+
+  tuner.reset();
+}
+
+TEST(AutoTunerUnitTest, File)
+{
+  const std::string filename = "test-autotuner.txt";
+  std::remove(filename.c_str());
+
+  AutoTuner& tuner = AutoTuner::getInstance();
+  tuner.reset();
+  tuner.file(filename);
+  const int old_trials = tuner.trials(1);
+
+  TunedKernel& k = tuner.kernel("saved\tkernel", 7, 2, 3);
+  tuner.record(k, tuner.next_policy(k), 2.0);
+  tuner.record(k, tuner.next_policy(k), 1.0);
+  ASSERT_EQ(k.choice.load(), 1);
+
+  // a later run starts tuned
+  tuner.reset();
+  tuner.file(filename);
+  ASSERT_EQ(tuner.kernel("saved\tkernel", 7, 2, 3).choice.load(), 1);
+  ASSERT_EQ(tuner.kernel("saved\tkernel", 7, 2, 2).choice.load(), -1);
+
+  // a saved choice for a list of another size is ignored
+  tuner.reset();
+  tuner.file(filename);
+  ASSERT_EQ(tuner.kernel("saved\tkernel", 7, 3, 3).choice.load(), -1);
+
+  tuner.trials(old_trials);
+  tuner.file("");
+  tuner.reset();
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for huge page and placed host allocators
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cstdint>
+#include <vector>
+
+TEST(HostAllocatorUnitTest, HugePageAllocator)
+{
+  std::vector<double, RAJA::huge_page_allocator<double>> vec(300000, 2.0);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(vec.data()) % RAJA::huge_page_size,
+            0u);
+  double sum = 0.0;
+  for (double val : vec) {
+    sum += val;
+  }
+  ASSERT_EQ(sum, 600000.0);
+
+  RAJA::basic_mempool::MemPool<RAJA::HugePageHostAllocator> pool;
+  pool.arena_size(RAJA::huge_page_size);
+  int* ptr = pool.malloc<int>(1000);
+  ASSERT_NE(ptr, nullptr);
+  ptr[999] = 1;
+  pool.free(ptr);
+  pool.free_chunks();
+}
+
+TEST(HostAllocatorUnitTest, LargeScratchReuse)
+{
+  RAJA::trim_host_scratch();
+  const size_t n = RAJA::host_scratch_pool_max_bytes / sizeof(double) + 1;
+
+  double* first = nullptr;
+  {
+    RAJA::host_scratch_ptr<double> scratch =
+        RAJA::allocate_host_scratch<double>(n);
+    ASSERT_NE(scratch.get(), nullptr);
+    scratch.get()[n - 1] = 1.0;
+    first = scratch.get();
+  }
+  ASSERT_EQ(RAJA::host_scratch_cached_bytes(), n * sizeof(double));
+
+  // a request that fits reuses the kept block
+  {
+    RAJA::host_scratch_ptr<double> scratch =
+        RAJA::allocate_host_scratch<double>(n - 1);
+    ASSERT_EQ(scratch.get(), first);
+    ASSERT_EQ(RAJA::host_scratch_cached_bytes(), 0u);
+  }
+
+  RAJA::trim_host_scratch();
+  ASSERT_EQ(RAJA::host_scratch_cached_bytes(), 0u);
+
+  // blocks above the limit are freed rather than kept
+  const size_t prev_max_bytes = RAJA::host_scratch_cache_max_bytes(0);
+  {
+    RAJA::host_scratch_ptr<double> scratch =
+        RAJA::allocate_host_scratch<double>(n);
+    ASSERT_NE(scratch.get(), nullptr);
+  }
+  ASSERT_EQ(RAJA::host_scratch_cached_bytes(), 0u);
+  RAJA::host_scratch_cache_max_bytes(prev_max_bytes);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+template <RAJA::omp::Placement placement, bool huge_pages>
+void testPlacedAllocator()
+{
+  using allocator =
+      RAJA::omp::placed_host_allocator<int, placement, huge_pages>;
+  const int len = 1000003;
+
+  std::vector<int, allocator> vec(len, 0);
+  int* data = vec.data();
+  RAJA::forall<RAJA::omp_parallel_for_static_exec<>>(
+      RAJA::TypedRangeSegment<int>(0, len), [=](int i) { data[i] = i; });
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(vec[i], i);
+  }
+
+  RAJA::basic_mempool::MemPool<
+      RAJA::omp::PlacedHostAllocator<placement, huge_pages>>
+      pool;
+  pool.arena_size(1024 * 1024);
+  double* ptr = pool.malloc<double>(1000);
+  ASSERT_NE(ptr, nullptr);
+  ptr[0] = ptr[999] = 1.0;
+  pool.free(ptr);
+  pool.free_chunks();
+}
+
+TEST(HostAllocatorUnitTest, PlacedAllocatorFirstTouch)
+{
+  testPlacedAllocator<RAJA::omp::Placement::first_touch, true>();
+  testPlacedAllocator<RAJA::omp::Placement::first_touch, false>();
+}
+
+TEST(HostAllocatorUnitTest, PlacedAllocatorInterleave)
+{
+  testPlacedAllocator<RAJA::omp::Placement::interleave, true>();
+  testPlacedAllocator<RAJA::omp::Placement::interleave, false>();
+}
+
+TEST(HostAllocatorUnitTest, PlacePagesKeepsContents)
+{
+  const size_t len = 3 * RAJA::omp::placement_page_size + 5;
+  std::vector<unsigned char> bytes(len);
+  for (size_t i = 0; i < len; ++i) {
+    bytes[i] = static_cast<unsigned char>(i * 7 + 1);
+  }
+
+  // start off a page boundary so the first element shares its page
+  RAJA::omp::place_pages(bytes.data() + 1, len - 1, 1,
+                         RAJA::omp::Placement::first_touch);
+  RAJA::omp::place_pages(bytes.data() + 1, (len - 1) / 4, 4,
+                         RAJA::omp::Placement::interleave);
+
+  for (size_t i = 0; i < len; ++i) {
+    ASSERT_EQ(bytes[i], static_cast<unsigned char>(i * 7 + 1));
+  }
+}
+#endif
@@ -0,0 +1,377 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using RAJA::basic_mempool::detail::MemoryArena;
+
+TEST(MemPoolUnitTest, ArenaRandomAllocations)
+{
+  const size_t size = 8ull * 1024ull * 1024ull;
+  char* mem = static_cast<char*>(std::malloc(size));
+  ASSERT_NE(mem, nullptr);
+
+  {
+    // start the arena off a granule boundary
+    MemoryArena arena(mem + 8, size - 8);
+
+    struct allocation {
+      unsigned char* ptr;
+      size_t nbytes;
+      unsigned char tag;
+    };
+    std::vector<allocation> live;
+    std::mt19937 rng(7);
+
+    for (int i = 0; i < 20000; ++i) {
+      if (live.empty() || rng() % 3 != 0) {
+        const size_t nbytes =
+            (rng() % 8 == 0) ? rng() % (size / 16) : rng() % 2048;
+        const size_t alignment = size_t(1) << (rng() % 12);
+        unsigned char* ptr =
+            static_cast<unsigned char*>(arena.get(nbytes, alignment));
+        if (ptr == nullptr) {
+          continue;
+        }
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+        ASSERT_GE(ptr, reinterpret_cast<unsigned char*>(mem));
+        ASSERT_LE(ptr + nbytes, reinterpret_cast<unsigned char*>(mem) + size);
+        const unsigned char tag = static_cast<unsigned char>(rng());
+        std::memset(ptr, tag, nbytes);
+        live.push_back(allocation{ptr, nbytes, tag});
+      } else {
+        const size_t idx = rng() % live.size();
+        for (size_t b = 0; b < live[idx].nbytes; ++b) {
+          ASSERT_EQ(live[idx].ptr[b], live[idx].tag);
+        }
+        ASSERT_TRUE(arena.give(live[idx].ptr));
+        live[idx] = live.back();
+        live.pop_back();
+      }
+    }
+
+    ASSERT_FALSE(live.empty());
+    ASSERT_FALSE(arena.unused());
+    for (allocation& a : live) {
+      ASSERT_TRUE(arena.give(a.ptr));
+    }
+    ASSERT_TRUE(arena.unused());
+
+    // freed blocks coalesce back into one block
+    void* all = arena.get(size - 2 * MemoryArena::min_granularity, 1);
+    ASSERT_NE(all, nullptr);
+    ASSERT_TRUE(arena.give(all));
+
+    int other;
+    ASSERT_FALSE(arena.give(&other));
+  }
+
+  std::free(mem);
+}
+
+TEST(MemPoolUnitTest, ArenaRequiredCapacity)
+{
+  for (size_t nbytes : {size_t(1), size_t(300), size_t(40000000)}) {
+    for (size_t alignment : {size_t(8), size_t(4096), size_t(1) << 20}) {
+      const size_t size = MemoryArena::required_capacity(nbytes, alignment);
+      char* mem = static_cast<char*>(std::malloc(size + 1));
+      ASSERT_NE(mem, nullptr);
+      {
+        MemoryArena arena(mem + 1, size);
+        void* ptr = arena.get(nbytes, alignment);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0u);
+        ASSERT_TRUE(arena.give(ptr));
+      }
+      std::free(mem);
+    }
+  }
+}
+
+TEST(MemPoolUnitTest, ArenaBlocksPast4GiB)
+{
+  if (sizeof(void*) < 8) {
+    return;
+  }
+  // the arena never touches its memory, so a reserved range that is not
+  // backed by memory can stand in for a 16 GiB allocation
+  const size_t size = 16ull << 30;
+  void* mem = reinterpret_cast<void*>(uintptr_t(1) << 44);
+  MemoryArena arena(mem, size);
+
+  void* first = arena.get(size_t(6) << 30, 1);
+  void* second = arena.get(size_t(6) << 30, 1);
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  ASSERT_GE(static_cast<char*>(second) - static_cast<char*>(mem),
+            std::ptrdiff_t(4) << 30);
+
+  ASSERT_TRUE(arena.give(second));
+  ASSERT_TRUE(arena.give(first));
+  ASSERT_TRUE(arena.unused());
+}
+
+TEST(MemPoolUnitTest, PoolMallocFree)
+{
+  RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator> pool;
+  pool.arena_size(1024 * 1024);
+
+  std::vector<double*> ptrs;
+  for (size_t n = 1; n < 200; ++n) {
+    double* ptr = pool.malloc<double>(n * 37);
+    ASSERT_NE(ptr, nullptr);
+    ptr[0] = ptr[n * 37 - 1] = static_cast<double>(n);
+    ptrs.push_back(ptr);
+  }
+  for (size_t n = 1; n < 200; ++n) {
+    ASSERT_EQ(ptrs[n - 1][0], static_cast<double>(n));
+    ASSERT_EQ(ptrs[n - 1][n * 37 - 1], static_cast<double>(n));
+    pool.free(ptrs[n - 1]);
+  }
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, PoolStatistics)
+{
+  RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator> pool;
+  pool.arena_size(1024 * 1024);
+
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.statistics();
+  ASSERT_EQ(stats.num_arenas, 0u);
+  ASSERT_EQ(stats.used_bytes, 0u);
+
+  char* small = pool.malloc<char>(100);
+  char* large = pool.malloc<char>(300 * 1024);
+  char* huge = pool.malloc<char>(3 * 1024 * 1024);
+
+  stats = pool.statistics();
+  ASSERT_EQ(stats.num_arenas, 2u);
+  ASSERT_EQ(stats.num_arena_mallocs, 2u);
+  ASSERT_EQ(stats.num_mallocs, 3u);
+  ASSERT_EQ(stats.num_frees, 0u);
+  ASSERT_GE(stats.used_bytes, 100u + 300u * 1024u + 3u * 1024u * 1024u);
+  ASSERT_EQ(stats.peak_used_bytes, stats.used_bytes);
+  ASSERT_EQ(stats.in_use_bytes(), stats.used_bytes);
+  ASSERT_GE(stats.arena_bytes, stats.used_bytes + stats.free_bytes);
+  ASSERT_EQ(stats.malloc_sizes[RAJA::basic_mempool::detail::size_bin(100)],
+            1u);
+
+  const size_t peak = stats.peak_used_bytes;
+  pool.free(huge);
+  pool.free(small);
+
+  stats = pool.statistics();
+  ASSERT_EQ(stats.num_frees, 2u);
+  ASSERT_EQ(stats.peak_used_bytes, peak);
+  ASSERT_LT(stats.used_bytes, 400u * 1024u);
+  ASSERT_GT(stats.fragmentation(), 0.0);
+  ASSERT_LT(stats.fragmentation(), 1.0);
+
+  pool.reset_statistics();
+  stats = pool.statistics();
+  ASSERT_EQ(stats.num_mallocs, 0u);
+  ASSERT_EQ(stats.peak_used_bytes, stats.used_bytes);
+
+  pool.free(large);
+  ASSERT_EQ(pool.statistics().used_bytes, 0u);
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheDisable)
+{
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+  pool_type pool;
+  pool.arena_size(1024 * 1024);
+  ASSERT_EQ(pool.thread_cache_size(64 * 1024), 0u);
+
+  std::vector<int*> live;
+  for (int i = 0; i < 64; ++i) {
+    live.push_back(pool.malloc<int>(64 + i));
+  }
+  for (int i = 0; i < 32; ++i) {
+    pool.free(live[i]);
+  }
+  ASSERT_GT(pool.statistics().thread_cached_bytes, 0u);
+
+  // blocks handed out by the destroyed cache are freed to the arenas
+  ASSERT_EQ(pool.thread_cache_size(0), 64u * 1024u);
+  ASSERT_EQ(pool.statistics().thread_cached_bytes, 0u);
+  for (int i = 32; i < 64; ++i) {
+    pool.free(live[i]);
+  }
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.statistics();
+  ASSERT_EQ(stats.used_bytes, 0u);
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+
+  // caching may be enabled again and gets a new cache
+  ASSERT_EQ(pool.thread_cache_size(64 * 1024), 0u);
+  int* ptr = pool.malloc<int>(64);
+  ASSERT_NE(ptr, nullptr);
+  pool.free(ptr);
+  ASSERT_GT(pool.statistics().thread_cached_bytes, 0u);
+
+  // blocks larger than the largest size class bypass the caches
+  int* large = pool.malloc<int>(RAJA::basic_mempool::detail::ThreadCache::
+                                    max_class_size);
+  ASSERT_NE(large, nullptr);
+  pool.free(large);
+
+  ASSERT_EQ(pool.thread_cache_size(0), 64u * 1024u);
+  ASSERT_EQ(pool.statistics().used_bytes, 0u);
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheCoarseArenas)
+{
+  if (sizeof(void*) < 8) {
+    return;
+  }
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+  pool_type pool;
+  // arenas this large have granules larger than the largest size class,
+  // the memory is never touched past the blocks handed out
+  pool.arena_size(size_t(2) << 30);
+  ASSERT_EQ(pool.thread_cache_size(1024 * 1024), 0u);
+
+  // a freed block goes back to the cache, which hands it out next
+  int* ptr = pool.malloc<int>(16);
+  pool.free(ptr);
+  ASSERT_EQ(pool.malloc<int>(16), ptr);
+
+  // and keeps doing so with many blocks handed out
+  std::vector<int*> live(1, ptr);
+  for (int i = 0; i < 300; ++i) {
+    live.push_back(pool.malloc<int>(16));
+  }
+  pool.free(live.back());
+  ASSERT_EQ(pool.malloc<int>(16), live.back());
+  for (int* p : live) {
+    pool.free(p);
+  }
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.statistics();
+  ASSERT_GT(stats.thread_cached_bytes, 0u);
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+
+  live.clear();
+  for (int i = 0; i < 300; ++i) {
+    live.push_back(pool.malloc<int>(16));
+  }
+  ASSERT_EQ(pool.thread_cache_size(0), 1024u * 1024u);
+  for (int* p : live) {
+    pool.free(p);
+  }
+  stats = pool.statistics();
+  ASSERT_EQ(stats.used_bytes, 0u);
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+
+  pool.free_chunks();
+}
+
+TEST(MemPoolUnitTest, ThreadCacheManyPools)
+{
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+  std::vector<std::unique_ptr<pool_type>> pools;
+  for (int i = 0; i < 200; ++i) {
+    pools.emplace_back(new pool_type);
+    pools.back()->arena_size(64 * 1024);
+    ASSERT_EQ(pools.back()->thread_cache_size(16 * 1024), 0u);
+    pools.back()->free(pools.back()->malloc<int>(16));
+    ASSERT_GT(pools.back()->statistics().thread_cached_bytes, 0u);
+  }
+
+  // every pool is flushed, however many have caching enabled
+  RAJA::basic_mempool::flush_thread_caches();
+  for (auto& pool : pools) {
+    ASSERT_EQ(pool->statistics().thread_cached_bytes, 0u);
+    pool->free_chunks();
+  }
+}
+
+#if defined(RAJA_ENABLE_OPENMP) || defined(RAJA_ENABLE_THREAD_POOL)
+TEST(MemPoolUnitTest, ThreadCacheThreads)
+{
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+  pool_type pool;
+  pool.arena_size(1024 * 1024);
+  ASSERT_EQ(pool.thread_cache_size(64 * 1024), 0u);
+
+  const int num_threads = 4;
+  std::vector<std::vector<int*>> allocated(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::mt19937 rng(t);
+      std::vector<int*> live;
+      for (int i = 0; i < 20000; ++i) {
+        if (live.empty() || rng() % 2 == 0) {
+          const size_t n = 1 + rng() % 1500;
+          int* ptr = pool.malloc<int>(n);
+          ASSERT_NE(ptr, nullptr);
+          ptr[0] = ptr[n - 1] = t;
+          live.push_back(ptr);
+        } else {
+          const size_t idx = rng() % live.size();
+          ASSERT_EQ(live[idx][0], t);
+          pool.free(live[idx]);
+          live[idx] = live.back();
+          live.pop_back();
+        }
+      }
+      allocated[t] = live;
+      pool.flush_thread_cache();
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // free blocks cached by other threads from this thread
+  for (int t = 0; t < num_threads; ++t) {
+    for (int* ptr : allocated[t]) {
+      ASSERT_EQ(ptr[0], t);
+      pool.free(ptr);
+    }
+  }
+
+  RAJA::basic_mempool::MemPoolStatistics stats = pool.statistics();
+  ASSERT_EQ(stats.num_mallocs, stats.num_frees);
+  ASSERT_GT(stats.thread_cached_bytes, 0u);
+  ASSERT_EQ(stats.in_use_bytes(), 0u);
+
+  ASSERT_EQ(pool.thread_cache_size(0), 64u * 1024u);
+  ASSERT_EQ(pool.statistics().used_bytes, 0u);
+
+  // everything went back to the arenas so a large block fits again
+  int* all = pool.malloc<int>(200 * 1024);
+  ASSERT_NE(all, nullptr);
+  pool.free(all);
+
+  pool.free_chunks();
+}
+#endif
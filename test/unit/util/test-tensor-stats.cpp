@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for tensor_stats
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/pattern/tensor/stats.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using RAJA::expt::tensor_stats;
+
+TEST(TensorStatsUnitTest, Threads)
+{
+  tensor_stats::resetVectorStats();
+
+  const int num_threads = 4;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([]() {
+      for (int i = 0; i < 100000; ++i) {
+        tensor_stats::count(tensor_stats::num_vector_load_strided);
+      }
+      tensor_stats::count(tensor_stats::num_matrix_mm_mult_row_row);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(tensor_stats::total(tensor_stats::num_vector_load_strided),
+            num_threads * 100000);
+  tensor_stats::counts totals = tensor_stats::totals();
+  ASSERT_EQ(totals[tensor_stats::num_matrix_mm_mult_row_row], num_threads);
+  ASSERT_EQ(totals[tensor_stats::num_vector_load_packed], 0);
+  ASSERT_STREQ(tensor_stats::name(tensor_stats::num_vector_load_strided),
+               "num_vector_load_strided");
+
+  tensor_stats::resetVectorStats();
+  ASSERT_EQ(tensor_stats::total(tensor_stats::num_vector_load_strided), 0);
+}
+
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+TEST(TensorStatsUnitTest, KernelAttribution)
+{
+  tensor_stats::resetVectorStats();
+  tensor_stats::attributeToKernels(true);
+
+#if defined(RAJA_ENABLE_OPENMP)
+  // every thread of the team counts into the block of the kernel
+  using gather_policy = RAJA::omp_parallel_for_exec;
+#else
+  using gather_policy = RAJA::seq_exec;
+#endif
+  RAJA::forall<gather_policy>(RAJA::RangeSegment(0, 1000),
+                              RAJA::expt::KernelName("gather"),
+                              [=](int) {
+    tensor_stats::count(tensor_stats::num_vector_load_strided_n);
+  });
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 5),
+                               RAJA::expt::KernelName("stream"),
+                               [=](int) {
+    tensor_stats::count(tensor_stats::num_vector_load_packed);
+  });
+  tensor_stats::count(tensor_stats::num_vector_fma);
+
+  tensor_stats::attributeToKernels(false);
+
+  std::map<std::string, tensor_stats::counts> kernels =
+      tensor_stats::kernelTotals();
+  ASSERT_EQ(kernels["gather"][tensor_stats::num_vector_load_strided_n], 1000);
+  ASSERT_EQ(kernels[""][tensor_stats::num_vector_load_strided_n], 0);
+  ASSERT_EQ(kernels["gather"][tensor_stats::num_vector_load_packed], 0);
+  ASSERT_EQ(kernels["stream"][tensor_stats::num_vector_load_packed], 5);
+  ASSERT_EQ(kernels[""][tensor_stats::num_vector_fma], 1);
+
+  const std::string filename = "test-tensor-stats.json";
+  ASSERT_TRUE(tensor_stats::writeVectorStats(filename));
+  std::ifstream file(filename);
+  std::stringstream json;
+  json << file.rdbuf();
+  ASSERT_NE(json.str().find("\"gather\":{"), std::string::npos);
+  ASSERT_NE(json.str().find("\"num_vector_load_strided_n\":1000"),
+            std::string::npos);
+  std::remove(filename.c_str());
+
+  tensor_stats::resetVectorStats();
+}
+#endif